@@ -3,6 +3,7 @@
 #include "Compatibility.h"
 #include "ScriptSettings.hpp"
 #include "DrivingAssists.h"
+#include "VehicleData.hpp"
 
 #include "Util/MathExt.h"
 #include "Util/Strings.hpp"
@@ -16,18 +17,28 @@
 #include <fmt/format.h>
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
 
 extern Vehicle g_playerVehicle;
 extern ScriptSettings g_settings;
+extern VehicleData g_vehData;
 
 using VExt = VehicleExtensions;
 namespace HR = HandlingReplacement;
 
+enum class ETransferSource : uint8_t {
+    None,
+    TractionRWD,
+    TractionFWD,
+    Oversteer,
+    Understeer,
+};
+
 struct STransferInfo {
     float TransferRatio;
     float NewDriveBiasF;
-    std::string Source;
+    ETransferSource Source;
 };
 
 namespace {
@@ -37,11 +48,22 @@ namespace {
 
     const float dbgX = 0.5f;
     const float dbgY = 0.0f;
+
+    const char* getSourceName(ETransferSource source) {
+        switch (source) {
+            case ETransferSource::TractionRWD:  return "Traction (RWD)";
+            case ETransferSource::TractionFWD:  return "Traction (FWD)";
+            case ETransferSource::Oversteer:    return "Oversteer";
+            case ETransferSource::Understeer:   return "Understeer";
+            case ETransferSource::None:
+            default:                            return "N/A";
+        }
+    }
 }
 
-STransferInfo GetTractionTransfer(float driveBiasF, float biasMax);
-STransferInfo GetOversteerTransfer(float driveBiasF, float biasMax, DrivingAssists::ESPData espData);
-STransferInfo GetUndersteerTransfer(float driveBiasF, float biasMax, DrivingAssists::ESPData espData);
+STransferInfo GetTractionTransfer(float driveBiasF, float biasMax, float throttle);
+STransferInfo GetOversteerTransfer(float driveBiasF, float biasMax, float throttle, const DrivingAssists::DynamicsState& dynamics);
+STransferInfo GetUndersteerTransfer(float driveBiasF, float biasMax, float throttle, const DrivingAssists::ESPData& espData);
 
 float AWD::GetDriveBiasFront(void* pHandlingDataOrig) {
     if (!pHandlingDataOrig)
@@ -92,7 +114,7 @@ void AWD::Update() {
         return;
     }
 
-    if (VExt::GetNumWheels(g_playerVehicle) != 4) {
+    if (g_vehData.mWheelCount != 4) {
         if (g_settings.Debug.DisplayInfo) {
             UI::ShowText(dbgX, dbgY, 0.5f, "Unsupported (need 4 wheels)");
         }
@@ -108,28 +130,29 @@ void AWD::Update() {
         driveBiasF = driveBiasFOriginal;
     }
 
-    std::vector<STransferInfo> transferInfos{
-      { -1.0f, -1.0f, "N/A" }, // Traction
-      { -1.0f, -1.0f, "N/A" }, // Oversteer
-      { -1.0f, -1.0f, "N/A" }, // Understeer
-    };
+    // Traction, Oversteer, Understeer
+    std::array<STransferInfo, 3> transferInfos{{
+        { -1.0f, -1.0f, ETransferSource::None },
+        { -1.0f, -1.0f, ETransferSource::None },
+        { -1.0f, -1.0f, ETransferSource::None },
+    }};
+
+    float throttle = VExt::GetThrottle(g_playerVehicle);
 
     if (g_settings().DriveAssists.AWD.UseTraction) {
-        transferInfos[0] = GetTractionTransfer(driveBiasF, biasMax);
+        transferInfos[0] = GetTractionTransfer(driveBiasF, biasMax, throttle);
     }
 
-
-    if (g_settings().DriveAssists.AWD.UseOversteer || g_settings().DriveAssists.AWD.UseUndersteer) {
-        DrivingAssists::ESPData espData = DrivingAssists::GetESP();
-        if (g_settings().DriveAssists.AWD.UseOversteer) {
-            transferInfos[1] = GetOversteerTransfer(driveBiasF, biasMax, espData);
-        }
-        if (g_settings().DriveAssists.AWD.UseUndersteer) {
-            transferInfos[2] = GetUndersteerTransfer(driveBiasF, biasMax, espData);
-        }
+    // ESP angles were already computed this tick.
+    const auto& dynamics = DrivingAssists::GetDynamics();
+    if (g_settings().DriveAssists.AWD.UseOversteer) {
+        transferInfos[1] = GetOversteerTransfer(driveBiasF, biasMax, throttle, dynamics);
+    }
+    if (g_settings().DriveAssists.AWD.UseUndersteer) {
+        transferInfos[2] = GetUndersteerTransfer(driveBiasF, biasMax, throttle, dynamics.ESP);
     }
 
-    STransferInfo maxTransferInfo = *std::max_element(transferInfos.begin(), transferInfos.end(),
+    const STransferInfo& maxTransferInfo = *std::max_element(transferInfos.begin(), transferInfos.end(),
         [](const auto& a, const auto& b) { return a.TransferRatio < b.TransferRatio; });
 
     if (maxTransferInfo.TransferRatio > 0.0f) {
@@ -143,7 +166,7 @@ void AWD::Update() {
     if (g_settings.Debug.DisplayInfo) {
         UI::ShowText(dbgX, dbgY, 0.5f, fmt::format("T: {:.2f}", driveBiasTransferRatio));
         UI::ShowText(dbgX, dbgY + 0.025f, 0.5f, fmt::format("F: {:.2f}", driveBiasF));
-        UI::ShowText(dbgX, dbgY + 0.050f, 0.5f, fmt::format("Src: {}", maxTransferInfo.Source));
+        UI::ShowText(dbgX, dbgY + 0.050f, 0.5f, fmt::format("Src: {}", getSourceName(maxTransferInfo.Source)));
     }
 
     // replace value in (current) handling
@@ -158,11 +181,11 @@ float AWD::GetTransferValue() {
     return driveBiasTransferRatio;
 }
 
-STransferInfo GetTractionTransfer(float driveBiasF, float biasMax) {
-    std::string source = "N/A";
+STransferInfo GetTractionTransfer(float driveBiasF, float biasMax, float throttle) {
+    ETransferSource source = ETransferSource::None;
     float driveBiasTransferRatio = 0.0f;
     float outBias = driveBiasF;
-    auto wheelSpeeds = VExt::GetTyreSpeeds(g_playerVehicle);
+    const auto& wheelSpeeds = g_vehData.mWheelTyreSpeeds;
 
     float avgFrontSpeed = (wheelSpeeds[0] + wheelSpeeds[1]) / 2.0f;
     float avgRearSpeed = (wheelSpeeds[2] + wheelSpeeds[3]) / 2.0f;
@@ -177,7 +200,6 @@ STransferInfo GetTractionTransfer(float driveBiasF, float biasMax) {
             wheelSpeeds[3] > avgFrontSpeed * tlMin)) {
 
         float maxSpeed = std::max(wheelSpeeds[2], wheelSpeeds[3]);
-        float throttle = VExt::GetThrottle(g_playerVehicle);
 
         driveBiasTransferRatio = map(maxSpeed, avgFrontSpeed * tlMin, avgFrontSpeed * tlMax, 0.0f, 1.0f) * throttle;
         driveBiasTransferRatio = std::clamp(driveBiasTransferRatio, 0.0f, 1.0f);
@@ -185,7 +207,7 @@ STransferInfo GetTractionTransfer(float driveBiasF, float biasMax) {
         outBias = map(driveBiasTransferRatio, 0.0f, 1.0f, driveBiasF, biasMax);
 
         outBias = std::clamp(outBias, 0.0f, biasMax);
-        source = "Traction (RWD)";
+        source = ETransferSource::TractionRWD;
     }
     // front biased
     else if (driveBiasF > 0.5f && avgRearSpeed > 1.0f &&
@@ -193,7 +215,6 @@ STransferInfo GetTractionTransfer(float driveBiasF, float biasMax) {
             wheelSpeeds[1] > avgRearSpeed * tlMin)) {
 
         float maxSpeed = std::max(wheelSpeeds[0], wheelSpeeds[1]);
-        float throttle = VExt::GetThrottle(g_playerVehicle);
 
         driveBiasTransferRatio = map(maxSpeed, avgRearSpeed * tlMin, avgRearSpeed * tlMax, 0.0f, 1.0f) * throttle;
         driveBiasTransferRatio = std::clamp(driveBiasTransferRatio, 0.0f, 1.0f);
@@ -201,7 +222,7 @@ STransferInfo GetTractionTransfer(float driveBiasF, float biasMax) {
         outBias = map(driveBiasTransferRatio, 0.0f, 1.0f, driveBiasF, biasMax);
 
         outBias = std::clamp(outBias, biasMax, 1.0f);
-        source = "Traction (FWD)";
+        source = ETransferSource::TractionFWD;
     }
     else {
         driveBiasTransferRatio = 0.0f;
@@ -210,14 +231,13 @@ STransferInfo GetTractionTransfer(float driveBiasF, float biasMax) {
     return { driveBiasTransferRatio, outBias, source };
 }
 
-STransferInfo GetOversteerTransfer(float driveBiasF, float biasMax, DrivingAssists::ESPData espData) {
+STransferInfo GetOversteerTransfer(float driveBiasF, float biasMax, float throttle, const DrivingAssists::DynamicsState& dynamics) {
     float transferRatio = 0.0f;
     float outBias = driveBiasF;
 
-    float oversteerDeg = rad2deg(espData.OversteerAngle);
+    float oversteerDeg = rad2deg(dynamics.ESP.OversteerAngle);
     if (abs(oversteerDeg) > g_settings().DriveAssists.AWD.OversteerMin &&
-        ENTITY::GET_ENTITY_SPEED(g_playerVehicle) > 1.0f) {
-        float throttle = VExt::GetThrottle(g_playerVehicle);
+        dynamics.Speed > 1.0f) {
         float osMin = g_settings().DriveAssists.AWD.OversteerMin;
         float osMax = g_settings().DriveAssists.AWD.OversteerMax;
 
@@ -231,17 +251,16 @@ STransferInfo GetOversteerTransfer(float driveBiasF, float biasMax, DrivingAssis
         outBias = std::clamp(outBias, 0.0f, 1.0f);
     }
 
-    return { transferRatio, outBias, "Oversteer" };
+    return { transferRatio, outBias, ETransferSource::Oversteer };
 }
 
-STransferInfo GetUndersteerTransfer(float driveBiasF, float biasMax, DrivingAssists::ESPData espData) {
+STransferInfo GetUndersteerTransfer(float driveBiasF, float biasMax, float throttle, const DrivingAssists::ESPData& espData) {
     float transferRatio = 0.0f;
     float outBias = driveBiasF;
 
     float understeerDeg = rad2deg(espData.UndersteerAngle);
     if (espData.UndersteerAngleValid &&
         understeerDeg > g_settings().DriveAssists.AWD.UndersteerMin) {
-        float throttle = VExt::GetThrottle(g_playerVehicle);
         float usMin = g_settings().DriveAssists.AWD.UndersteerMin;
         float usMax = g_settings().DriveAssists.AWD.UndersteerMax;
 
@@ -255,5 +274,5 @@ STransferInfo GetUndersteerTransfer(float driveBiasF, float biasMax, DrivingAssi
         outBias = std::clamp(outBias, 0.0f, 1.0f);
     }
 
-    return { transferRatio, outBias, "Understeer" };
+    return { transferRatio, outBias, ETransferSource::Understeer };
 }
@@ -0,0 +1,108 @@
+// Drives the ABS slip controller with a synthetic single-wheel brake trace
+// at different frame rates, and compares stopping distance and modulation
+// frequency. Not part of the plugin, SlipController has no game calls so it
+// builds on its own:
+//   g++ -std=c++17 -O2 -I.. SlipControllerBench.cpp ../SlipController.cpp
+//   cl /std:c++17 /O2 /EHsc /I.. SlipControllerBench.cpp ..\SlipController.cpp
+
+#include "SlipController.h"
+
+#include <cmath>
+#include <cstdio>
+
+namespace {
+    // Quarter car with a Pacejka-like friction curve, integrated on a much
+    // smaller step than any frame, like the game's own physics.
+    struct SWheelModel {
+        float Mass = 400.0f;        // kg
+        float Radius = 0.33f;       // m
+        float Inertia = 1.2f;       // kg m^2
+        float MaxBrakeTorque = 3000.0f; // Nm at full pressure
+
+        float Speed = 30.0f;        // m/s
+        float WheelSpeed = 30.0f / 0.33f; // rad/s
+        float Distance = 0.0f;      // m
+
+        float Friction(float slip) const {
+            const float B = 10.0f, C = 1.9f, D = 1.0f;
+            return D * std::sin(C * std::atan(B * slip));
+        }
+
+        void Step(float pressure, float dt) {
+            float slip = Speed > 0.1f ? (Speed - WheelSpeed * Radius) / Speed : 0.0f;
+            float force = Friction(slip) * Mass * 9.81f;
+            WheelSpeed += dt * (force * Radius - MaxBrakeTorque * pressure) / Inertia;
+            WheelSpeed = std::fmax(WheelSpeed, 0.0f);
+            Speed = std::fmax(Speed - dt * force / Mass, 0.0f);
+            Distance += Speed * dt;
+        }
+    };
+
+    struct SResult {
+        float Distance;     // m, until the controller's minimum speed
+        float Time;         // s
+        float Frequency;    // release cycles per second
+        float MeanSlip;
+    };
+
+    // abs:     Run with the controller, or lock the wheel with full pressure.
+    // reverse: Feed the controller negative speeds, like braking in reverse.
+    SResult run(float frameRate, bool abs, bool reverse = false) {
+        const float frameTime = 1.0f / frameRate;
+        const float physicsStep = 1.0f / 10000.0f;
+        const int physicsSteps = static_cast<int>(std::lround(frameTime / physicsStep));
+
+        SlipController controller;
+        SWheelModel wheel;
+        const uint8_t active = 1;
+
+        float time = 0.0f;
+        float slipSum = 0.0f;
+        int frames = 0;
+        while (wheel.Speed > controller.Params().MinSpeed && time < 30.0f) {
+            float tyreSpeed = wheel.WheelSpeed * wheel.Radius;
+            float pressure = 1.0f;
+            if (abs) {
+                float sign = reverse ? -1.0f : 1.0f;
+                float signedTyreSpeed = sign * tyreSpeed;
+                controller.Update(frameTime, sign * wheel.Speed, &signedTyreSpeed, &active, 1);
+                pressure = controller.Wheel(0).Pressure;
+            }
+            slipSum += (wheel.Speed - tyreSpeed) / wheel.Speed;
+            ++frames;
+
+            // The game applies the pressure written this frame until the next one.
+            for (int i = 0; i < physicsSteps; ++i) {
+                wheel.Step(pressure, physicsStep);
+            }
+            time += frameTime;
+        }
+
+        return {
+            wheel.Distance,
+            time,
+            static_cast<float>(controller.Wheel(0).Cycles) / time,
+            slipSum / static_cast<float>(frames),
+        };
+    }
+}
+
+int main() {
+    const float frameRates[] = { 30.0f, 60.0f, 144.0f };
+
+    std::printf("30 m/s to %.0f m/s\n", SlipController().Params().MinSpeed);
+    std::printf("%8s %6s %10s %8s %12s %10s\n", "fps", "abs", "distance", "time", "cycles/s", "mean slip");
+    for (float frameRate : frameRates) {
+        for (bool abs : { false, true }) {
+            SResult result = run(frameRate, abs);
+            std::printf("%8.0f %6s %9.2fm %7.2fs %12.1f %10.3f\n",
+                frameRate, abs ? "on" : "off", result.Distance, result.Time,
+                result.Frequency, result.MeanSlip);
+        }
+        SResult result = run(frameRate, true, true);
+        std::printf("%8.0f %6s %9.2fm %7.2fs %12.1f %10.3f\n",
+            frameRate, "rev", result.Distance, result.Time,
+            result.Frequency, result.MeanSlip);
+    }
+    return 0;
+}
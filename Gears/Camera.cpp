@@ -8,6 +8,9 @@
 #include "Util/ScriptUtils.h"
 #include "Util/MathExt.h"
 #include "Util/Timer.h"
+#include "Util/EntityCache.h"
+#include "Util/RingBuffer.h"
+#include "Util/FastMath.h"
 #include "Memory/NativeMemory.hpp"
 #include "Memory/Versions.h"
 #include "ManualTransmission.h"
@@ -56,7 +59,7 @@ namespace {
 
     // forward camera movement
     float accelMoveFwd = 0.0f;
-    std::vector<float> accelAvg;
+    RingBuffer<float, 4> accelAvg;
 }
 
 namespace FPVCam {
@@ -96,7 +99,7 @@ void FPVCam::CancelCam() {
     }
     directionLookAngle = 0.0f;
     accelMoveFwd = 0.0f;
-    accelAvg.clear();
+    accelAvg.Clear();
     driverHeadOffsetStatic = {};
 }
 
@@ -356,7 +359,7 @@ void updateControllerLook(bool& lookingIntoGlass) {
     }
 
     camRot.x = lerp(camRot.x, 90.0f * -lookUpDown,
-        1.0f - pow(g_settings().Misc.Camera.LookTime, MISC::GET_FRAME_TIME()));
+        1.0f - FastMath::Pow(g_settings().Misc.Camera.LookTime, MISC::GET_FRAME_TIME()));
 
     if (PAD::GET_CONTROL_NORMAL(0, eControl::ControlVehicleLookBehind) != 0.0f) {
         float lookBackAngle = -179.0f; // Look over right shoulder
@@ -364,12 +367,12 @@ void updateControllerLook(bool& lookingIntoGlass) {
             lookBackAngle = 179.0f; // Look over left shoulder
         }
         camRot.z = lerp(camRot.z, lookBackAngle,
-            1.0f - pow(g_settings().Misc.Camera.LookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.LookTime, MISC::GET_FRAME_TIME()));
     }
     else {
         // Manual look
         camRot.z = lerp(camRot.z, 179.0f * -lookLeftRight,
-            1.0f - pow(g_settings().Misc.Camera.LookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.LookTime, MISC::GET_FRAME_TIME()));
     }
 }
 
@@ -398,9 +401,9 @@ void updateMouseLook(bool& lookingIntoGlass) {
 
     if (lastMouseLookInputTimer.Expired() && Length(g_vehData.mVelocity) > 1.0f && !lookBehind) {
         lookUpDownAcc = lerp(lookUpDownAcc, 0.0f,
-            1.0f - pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
         lookLeftRightAcc = lerp(lookLeftRightAcc, 0.0f,
-            1.0f - pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
     }
     else {
         lookUpDownAcc += lookUpDown;
@@ -423,7 +426,7 @@ void updateMouseLook(bool& lookingIntoGlass) {
     }
 
     camRot.x = lerp(camRot.x, 90 * -lookUpDownAcc,
-        1.0f - pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
+        1.0f - FastMath::Pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
 
     // Override any camRot.z changes while looking back 
     if (lookBehind) {
@@ -432,11 +435,11 @@ void updateMouseLook(bool& lookingIntoGlass) {
             lookBackAngle = 179.0f; // Look over left shoulder
         }
         camRot.z = lerp(camRot.z, lookBackAngle,
-            1.0f - pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
     }
     else {
         camRot.z = lerp(camRot.z, 179.0f * -lookLeftRightAcc,
-            1.0f - pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
     }
 }
 
@@ -452,7 +455,7 @@ void updateWheelLook(bool& lookingIntoGlass) {
         float maxAngle = lookingIntoGlass ? 135.0f : 179.0f;
         float lookBackAngle = g_peripherals.LookBackRShoulder ? -1.0f * maxAngle : maxAngle;
         camRot.z = lerp(camRot.z, lookBackAngle,
-            1.0f - pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
     }
     else {
         float angle;
@@ -463,12 +466,12 @@ void updateWheelLook(bool& lookingIntoGlass) {
             angle = -90.0f;
         }
         camRot.z = lerp(camRot.z, angle,
-            1.0f - pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(g_settings().Misc.Camera.MouseLookTime, MISC::GET_FRAME_TIME()));
     }
 }
 
 void updateRotationCameraMovement() {
-    Vector3 speedVector = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
+    Vector3 speedVector = EntityCache::GetSpeedVector(g_playerVehicle);
 
     Vector3 target = Normalize(speedVector);
     float travelDir = atan2(target.y, target.x) - static_cast<float>(M_PI) / 2.0f;
@@ -479,7 +482,7 @@ void updateRotationCameraMovement() {
         travelDir += static_cast<float>(M_PI);
     }
 
-    Vector3 rotationVelocity = ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle);
+    Vector3 rotationVelocity = EntityCache::GetRotationVelocity(g_playerVehicle);
 
     float velComponent = travelDir * g_settings().Misc.Camera.Movement.RotationDirectionMult;
     float rotComponent = rotationVelocity.z * g_settings().Misc.Camera.Movement.RotationRotationMult;
@@ -505,18 +508,15 @@ void updateRotationCameraMovement() {
     }
 
     directionLookAngle = lerp(directionLookAngle, newAngle,
-        1.0f - pow(0.000001f, MISC::GET_FRAME_TIME()));
+        1.0f - FastMath::Pow(0.000001f, MISC::GET_FRAME_TIME()));
 }
 
 void updateLongitudinalCameraMovement() {
-    accelAvg.push_back(g_vehData.mAcceleration.y);
-    while (accelAvg.size() > 4) {
-        accelAvg.erase(accelAvg.begin());
-    }
+    accelAvg.Push(g_vehData.mAcceleration.y);
 
-    float lerpF = 1.0f - pow(0.000001f, MISC::GET_FRAME_TIME());
+    float lerpF = 1.0f - FastMath::Pow(0.000001f, MISC::GET_FRAME_TIME());
 
-    float gForce = avg(accelAvg) / 9.81f;
+    float gForce = accelAvg.Mean() / 9.81f;
 
     //gForce = abs(pow(gForce, g_settings().Misc.Camera.Movement.LongGamma)) * sgn(gForce);
 
@@ -2,9 +2,12 @@
 
 #include "SteeringAnim.h"
 #include "ScriptSettings.hpp"
+#include "VehicleData.hpp"
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
 #include "Util/ScriptUtils.h"
+#include "Util/EntityCache.h"
+#include "Util/FastMath.h"
 #include "Memory/VehicleExtensions.hpp"
 #include "Memory/VehicleBone.h"
 
@@ -20,6 +23,7 @@ extern Vehicle g_playerVehicle;
 extern Ped g_playerPed;
 extern ScriptSettings g_settings;
 extern CarControls g_controls;
+extern VehicleData g_vehData;
 
 namespace {
     float steerPrev = 0.0f;
@@ -27,6 +31,8 @@ namespace {
 
     bool mouseDown = false;
     float mouseXTravel = 0.0f;
+
+    FastMath::GammaCurve steeringGamma;
 }
 
 namespace CustomSteering {
@@ -45,7 +51,7 @@ float CustomSteering::calculateReduction() {
     Vehicle mVehicle = g_playerVehicle;
     float mult = 1;
     Vector3 vel = ENTITY::GET_ENTITY_VELOCITY(mVehicle);
-    Vector3 pos = ENTITY::GET_ENTITY_COORDS(mVehicle, 1);
+    Vector3 pos = EntityCache::GetCoords(mVehicle);
     Vector3 motion = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(mVehicle, pos.x + vel.x, pos.y + vel.y,
         pos.z + vel.z);
     if (motion.y > 3) {
@@ -62,7 +68,7 @@ float CustomSteering::calculateDesiredHeading(float steeringMax, float desiredHe
     // Scale input with both reduction and steering limit
     float correction;
 
-    Vector3 speedVector = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
+    Vector3 speedVector = EntityCache::GetSpeedVector(g_playerVehicle);
     if (abs(speedVector.y) > 3.0f) {
         Vector3 target = Normalize(speedVector);
         float travelDir = atan2(target.y, target.x) - static_cast<float>(M_PI) / 2.0f;
@@ -99,12 +105,12 @@ float CustomSteering::calculateDesiredHeading(float steeringMax, float desiredHe
 void CustomSteering::DrawDebug() {
     float steeringAngle = VExt::GetSteeringAngle(g_playerVehicle);
 
-    Vector3 speedVector = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
-    Vector3 positionWorld = ENTITY::GET_ENTITY_COORDS(g_playerVehicle, 1);
+    Vector3 speedVector = EntityCache::GetSpeedVector(g_playerVehicle);
+    Vector3 positionWorld = EntityCache::GetCoords(g_playerVehicle);
     Vector3 travelRelative = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, speedVector.x, speedVector.y, speedVector.z);
 
-    float steeringAngleRelX = ENTITY::GET_ENTITY_SPEED(g_playerVehicle) * -sin(steeringAngle);
-    float steeringAngleRelY = ENTITY::GET_ENTITY_SPEED(g_playerVehicle) * cos(steeringAngle);
+    float steeringAngleRelX = EntityCache::GetSpeed(g_playerVehicle) * -sin(steeringAngle);
+    float steeringAngleRelY = EntityCache::GetSpeed(g_playerVehicle) * cos(steeringAngle);
     Vector3 steeringWorld = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, steeringAngleRelX, steeringAngleRelY, 0.0f);
 
     //showText(0.3f, 0.15f, 0.5f, fmt::format("Angle: {}", rad2deg(steeringAngle)));
@@ -136,14 +142,7 @@ void disableControls() {
     // 7: Amphibious bike
     int modelType = VExt::GetModelType(g_playerVehicle);
     bool isFrog = modelType == 5 || modelType == 6 || modelType == 7;//*(int*)(modelInfo + 0x340) == 6 || *(int*)(modelInfo + 0x340) == 7;
-    bool hasFork = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "forks") != -1;
-    bool hasTow = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "tow_arm") != -1;
-    bool hasScoop = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "scoop") != -1;
-    bool hasFrame1 = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "frame_1") != -1;
-    bool hasFrame2 = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "frame_2") != -1;
-    bool hasFrame = hasFrame1 && hasFrame2;
-
-    bool hasEquipment = hasFork || hasTow || hasScoop || hasFrame;
+    bool hasEquipment = g_vehData.mHasEquipment;
 
     float hoverRatio = VExt::GetHoverTransformRatio(g_playerVehicle);
 
@@ -200,8 +199,8 @@ void CustomSteering::Update() {
 
     float steerCurr;
 
-    float steerValGammaL = pow(-steer, g_settings.CustomSteering.Gamma);
-    float steerValGammaR = pow(steer, g_settings.CustomSteering.Gamma);
+    float steerValGammaL = steeringGamma(-steer, g_settings.CustomSteering.Gamma);
+    float steerValGammaR = steeringGamma(steer, g_settings.CustomSteering.Gamma);
     float steerValGamma = steer < 0.0f ? -steerValGammaL : steerValGammaR;
 
     float secondsSinceLastTick = static_cast<float>(GetTickCount64() - lastTickTime) / 1000.0f;
@@ -210,13 +209,13 @@ void CustomSteering::Update() {
         steerCurr = lerp(
             steerPrev,
             steerValGamma,
-            1.0f - pow(g_settings.CustomSteering.CenterTime, secondsSinceLastTick));
+            1.0f - FastMath::Pow(g_settings.CustomSteering.CenterTime, secondsSinceLastTick));
     }
     else {
         steerCurr = lerp(
             steerPrev,
             steerValGamma,
-            1.0f - pow(g_settings.CustomSteering.SteerTime, secondsSinceLastTick));
+            1.0f - FastMath::Pow(g_settings.CustomSteering.SteerTime, secondsSinceLastTick));
     }
 
     bool mouseInputThisTick = false;
@@ -251,10 +250,10 @@ void CustomSteering::Update() {
 
     VExt::SetSteeringInputAngle(g_playerVehicle, desiredHeading * (1.0f / limitRadians));
 
-    if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle))
+    if (!EntityCache::GetEngineRunning(g_playerVehicle))
         VExt::SetSteeringAngle(g_playerVehicle, desiredHeading);
 
-    auto boneIdx = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "steeringwheel");
+    auto boneIdx = g_vehData.mSteeringWheelBone;
     if (boneIdx != -1 && g_settings().Steering.CustomSteering.UseCustomLock) {
         Vector3 rotAxis{};
         rotAxis.y = 1.0f;
@@ -267,7 +266,7 @@ void CustomSteering::Update() {
         // Not sure if this is the best solution, but hey, it works!
         rotDeg -= 2.0f * rad2deg(corrDesiredHeading * VExt::GetMaxSteeringAngle(g_playerVehicle));
 
-        VehicleBones::RotateAxis(g_playerVehicle, boneIdx, rotAxis, rotDeg);
+        g_vehData.mSkeleton.RotateAxis(boneIdx, rotAxis, rotDeg);
         SteeringAnimation::SetRotation(rotDegRaw);
     }
 }
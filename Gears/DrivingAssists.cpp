@@ -1,15 +1,20 @@
 #include "DrivingAssists.h"
 #include "ScriptSettings.hpp"
 #include "VehicleData.hpp"
+#include "SlipController.h"
 
 #include "Memory/Offsets.hpp"
 #include "Memory/VehicleExtensions.hpp"
 
 #include "Util/MathExt.h"
+#include "Util/EntityCache.h"
+#include "Util/FastMath.h"
 
 #include <inc/natives.h>
 #include <fmt/format.h>
 
+#include <algorithm>
+
 #include "Util/UIUtils.h"
 
 using VExt = VehicleExtensions;
@@ -19,154 +24,120 @@ extern Vehicle g_playerVehicle;
 extern VehicleData g_vehData;
 extern CarControls g_controls;
 
-DrivingAssists::ABSData DrivingAssists::GetABS() {
-    bool lockedUp = false;
-    auto brakePressures = VExt::GetWheelBrakePressure(g_playerVehicle);
-    for (int i = 0; i < g_vehData.mWheelCount; i++) {
-        if (g_vehData.mWheelsLockedUp[i] && g_vehData.mSuspensionTravel[i] > 0.0f && brakePressures[i] > 0.0f)
-            lockedUp = true;
-    }
-    if (g_vehData.mHandbrake || VEHICLE::IS_VEHICLE_IN_BURNOUT(g_playerVehicle))
-        lockedUp = false;
+namespace {
+    SlipController absController;
+    Vehicle absVehicle = 0;
 
-    bool absNativePresent = g_vehData.mHasABS && g_settings().DriveAssists.ABS.Filter;
+    DrivingAssists::DynamicsState dynamics{};
+    DrivingAssists::AssistData lastAssists{};
 
-    if (g_settings().DriveAssists.ABS.Enable && lockedUp && !absNativePresent)
-        return { true };
+    float getSteerMult() {
+        if (g_controls.PrevInput == CarControls::InputDevices::Wheel)
+            return g_settings().Steering.Wheel.SteeringMult;
+        return g_settings().Steering.CustomSteering.SteeringMult;
+    }
 
-    return { false };
-}
+    DrivingAssists::ESPData getESP(const DrivingAssists::DynamicsState& dyn, bool anyWheelOnGround) {
+        DrivingAssists::ESPData espData{};
+        float speed = dyn.Speed;
+        float velocityX = dyn.SpeedVector.x;
+        float velocityY = dyn.SpeedVector.y;
+        Vector3 vecNextSpd = dyn.SpeedVector;
+        Vector3 rotVel = dyn.RotationVelocity;
+        Vector3 rotRelative{
+            speed * -FastMath::Sin(rotVel.z), 0,
+            speed * FastMath::Cos(rotVel.z), 0,
+            0, 0
+        };
 
-DrivingAssists::TCSData DrivingAssists::GetTCS() {
-    std::vector<bool> slipped(g_vehData.mWheelCount);
-    bool tractionLoss = false;
-    if (g_settings().DriveAssists.TCS.Enable) {
-        auto pows = VExt::GetWheelPower(g_playerVehicle);
-        for (int i = 0; i < g_vehData.mWheelCount; i++) {
-            if (g_vehData.mWheelTyreSpeeds[i] > g_vehData.mVelocity.y + g_settings().DriveAssists.TCS.SlipMax &&
-                g_vehData.mSuspensionTravel[i] > 0.0f &&
-                g_vehData.mWheelsDriven[i] &&
-                pows[i] > 0.1f) {
-                tractionLoss = true;
-                slipped[i] = true;
-            }
-        }
-        if (g_vehData.mHandbrake || VEHICLE::IS_VEHICLE_IN_BURNOUT(g_playerVehicle))
-            tractionLoss = false;
-    }
+        float avgAngle = VExt::GetWheelAverageAngle(g_playerVehicle) * getSteerMult();
+        espData.SteerAngle = avgAngle;
 
-    if (g_settings().DriveAssists.TCS.Enable && tractionLoss)
-        return { true, slipped };
-    return { false, slipped };
-}
+        // understeer
+        {
+            Vector3 vecNextRot = (vecNextSpd + rotRelative) * 0.5f;
+            Vector3 vecNextRotNorm = Normalize(vecNextRot);
+            Vector3 vecFrontNorm{};
+            vecFrontNorm.y = 1.0f;
+
+            float anglePhys = GetAngleBetween(vecFrontNorm, vecNextRotNorm);
+            espData.UndersteerAngle = abs(avgAngle) - abs(anglePhys);
+            espData.UndersteerAngleValid = espData.UndersteerAngle > 0.0f && Length(vecNextRot) > 3.0f;
 
-DrivingAssists::ESPData DrivingAssists::GetESP() {
-    ESPData espData{};
-    float speed = ENTITY::GET_ENTITY_SPEED(g_playerVehicle);
-    Vector3 vecNextSpd = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
-    Vector3 rotVel = ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle);
-    Vector3 rotRelative{
-        speed * -sin(rotVel.z), 0,
-        speed * cos(rotVel.z), 0,
-        0, 0
-    };
-    float steerMult = g_settings().Steering.CustomSteering.SteeringMult;
-    if (g_controls.PrevInput == CarControls::InputDevices::Wheel)
-        steerMult = g_settings().Steering.Wheel.SteeringMult;
-
-    float avgAngle = VExt::GetWheelAverageAngle(g_playerVehicle) * steerMult;
-
-    // understeer
-    {
-        Vector3 vecNextRot = (vecNextSpd + rotRelative) * 0.5f;
-        Vector3 vecNextRotNorm = Normalize(vecNextRot);
-        Vector3 vecFrontNorm{};
-        vecFrontNorm.y = 1.0f;
-
-        float anglePhys = GetAngleBetween(vecFrontNorm, vecNextRotNorm);
-        espData.UndersteerAngle = abs(avgAngle) - abs(anglePhys);
-        espData.UndersteerAngleValid = espData.UndersteerAngle > 0.0f && Length(vecNextRot) > 3.0f;
-
-        if (espData.UndersteerAngleValid &&
-            abs(espData.UndersteerAngle) > deg2rad(g_settings().DriveAssists.ESP.UnderMin)) {
-            espData.Understeer = true;
+            if (espData.UndersteerAngleValid &&
+                abs(espData.UndersteerAngle) > deg2rad(g_settings().DriveAssists.ESP.UnderMin)) {
+                espData.Understeer = true;
+            }
         }
-    }
 
-    // oversteer
-    {
-        espData.OversteerAngle = acos(g_vehData.mVelocity.y / speed);
-        if (isnan(espData.OversteerAngle))
-            espData.OversteerAngle = 0.0;
+        // oversteer
+        {
+            espData.OversteerAngle = FastMath::Acos(velocityY / speed);
+            if (isnan(espData.OversteerAngle))
+                espData.OversteerAngle = 0.0;
 
-        if (espData.OversteerAngle > deg2rad(g_settings().DriveAssists.ESP.OverMin) && g_vehData.mVelocity.y > 10.0f) {
-            espData.Oversteer = true;
+            if (espData.OversteerAngle > deg2rad(g_settings().DriveAssists.ESP.OverMin) && velocityY > 10.0f) {
+                espData.Oversteer = true;
 
-            if (sgn(g_vehData.mVelocity.x) == sgn(avgAngle)) {
-                espData.OppositeLock = true;
+                if (sgn(velocityX) == sgn(avgAngle)) {
+                    espData.OppositeLock = true;
+                }
             }
         }
-    }
-    bool anyWheelOnGround = false;
-    for (bool value : g_vehData.mWheelsOnGround) {
-        anyWheelOnGround |= value;
-    }
-    if (g_settings().DriveAssists.ESP.Enable && g_vehData.mWheelCount == 4 && anyWheelOnGround) {
-        if (espData.Oversteer || espData.Understeer) {
-            espData.Use = true;
+
+        if (g_settings().DriveAssists.ESP.Enable && g_vehData.mWheelCount == 4 && anyWheelOnGround) {
+            if (espData.Oversteer || espData.Understeer) {
+                espData.Use = true;
+            }
         }
+
+        return espData;
     }
 
-    return espData;
-}
+    DrivingAssists::LSDData getLSD(const DrivingAssists::WheelBlock& wheels) {
+        DrivingAssists::LSDData lsdData{};
 
-DrivingAssists::LSDData DrivingAssists::GetLSD() {
-    LSDData lsdData{};
+        if (!g_settings().DriveAssists.LSD.Enable ||
+            wheels.Count != 4 ||
+            wheels.AverageDrivenTyreSpeed <= 0.0f ||
+            wheels.Handbrake ||
+            wheels.Burnout) {
+            return lsdData;
+        }
 
-    if (g_settings().DriveAssists.LSD.Enable &&
-        g_vehData.mWheelCount == 4 &&
-        g_vehData.mWheelAverageDrivenTyreSpeed > 0.0f &&
-        !VExt::GetHandbrake(g_playerVehicle) &&
-        !VEHICLE::IS_VEHICLE_IN_BURNOUT(g_playerVehicle)) {
-        auto angularVelocities = VExt::GetWheelRotationSpeeds(g_playerVehicle);
-        float WheelSpeedLF = angularVelocities[0];
-        float WheelSpeedRF = angularVelocities[1];
-        float WheelSpeedLR = angularVelocities[2];
-        float WheelSpeedRR = angularVelocities[3];
+        float WheelSpeedLF = wheels.RotationSpeed[0];
+        float WheelSpeedRF = wheels.RotationSpeed[1];
+        float WheelSpeedLR = wheels.RotationSpeed[2];
+        float WheelSpeedRR = wheels.RotationSpeed[3];
 
         float visc = g_settings().DriveAssists.LSD.Viscosity;
         float dbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fDriveBiasFront);
         float dbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fDriveBiasRear);
-        float clutch = std::clamp(g_vehData.mClutch, 0.0f, 1.0f);
+        float clutch = std::clamp(wheels.Clutch, 0.0f, 1.0f);
 
         // pos: neg brake left, neg throttle right
         float frontDiffDiff = (WheelSpeedLF - WheelSpeedRF) / (WheelSpeedLF + WheelSpeedRF);
         if (WheelSpeedLF == 0.0f || WheelSpeedRF == 0.0f)
             frontDiffDiff = 0.0f;
-        lsdData.BrakeLF = frontDiffDiff / 2.0f * dbalF * visc * g_vehData.mThrottle * clutch;
-        lsdData.BrakeRF = -frontDiffDiff / 2.0f * dbalF * visc * g_vehData.mThrottle * clutch;
+        lsdData.BrakeLF = frontDiffDiff / 2.0f * dbalF * visc * wheels.Throttle * clutch;
+        lsdData.BrakeRF = -frontDiffDiff / 2.0f * dbalF * visc * wheels.Throttle * clutch;
         lsdData.FDD = frontDiffDiff;
 
         float rearDiffDiff = (WheelSpeedLR - WheelSpeedRR) / (WheelSpeedLR + WheelSpeedRR);
         if (WheelSpeedLR == 0.0f || WheelSpeedRR == 0.0f)
             rearDiffDiff = 0.0f;
-        lsdData.BrakeLR = rearDiffDiff / 2.0f * dbalR * visc * g_vehData.mThrottle * clutch;
-        lsdData.BrakeRR = -rearDiffDiff / 2.0f * dbalR * visc * g_vehData.mThrottle * clutch;
+        lsdData.BrakeLR = rearDiffDiff / 2.0f * dbalR * visc * wheels.Throttle * clutch;
+        lsdData.BrakeRR = -rearDiffDiff / 2.0f * dbalR * visc * wheels.Throttle * clutch;
         lsdData.RDD = rearDiffDiff;
 
-        if (lsdData.BrakeLF > 0.0f) { lsdData.BrakeLF = 0.0f; }
-        if (lsdData.BrakeRF > 0.0f) { lsdData.BrakeRF = 0.0f; }
-        if (lsdData.BrakeLR > 0.0f) { lsdData.BrakeLR = 0.0f; }
-        if (lsdData.BrakeRR > 0.0f) { lsdData.BrakeRR = 0.0f; }
+        lsdData.BrakeLF = std::min(lsdData.BrakeLF, 0.0f);
+        lsdData.BrakeRF = std::min(lsdData.BrakeRF, 0.0f);
+        lsdData.BrakeLR = std::min(lsdData.BrakeLR, 0.0f);
+        lsdData.BrakeRR = std::min(lsdData.BrakeRR, 0.0f);
 
-        auto unBrakes = {
-            lsdData.BrakeLF,
-            lsdData.BrakeRF,
-            lsdData.BrakeLR,
-            lsdData.BrakeRR
-        };
+        float minBrake = std::min({ lsdData.BrakeLF, lsdData.BrakeRF, lsdData.BrakeLR, lsdData.BrakeRR });
 
-        if (*std::min_element(unBrakes.begin(), unBrakes.end()) < -0.05f) {
+        if (minBrake < -0.05f) {
             lsdData.Use = true;
         }
         else {
@@ -176,158 +147,256 @@ DrivingAssists::LSDData DrivingAssists::GetLSD() {
             lsdData.BrakeLF = 0.0f;
             lsdData.BrakeRF = 0.0f;
         }
+        return lsdData;
     }
-    return lsdData;
-}
 
-std::vector<float> DrivingAssists::GetESPBrakes(ESPData espData, LSDData lsdData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount); // only works for 4 wheels but ok
+    // Only defined for 4 wheels, other wheels get 0.
+    DrivingAssists::WheelArray<float> getLSDVals(const DrivingAssists::WheelBlock& wheels,
+        const DrivingAssists::LSDData& lsdData) {
+        DrivingAssists::WheelArray<float> lsdVals{};
+        if (wheels.Count == 4) {
+            lsdVals[0] = lsdData.BrakeLF;
+            lsdVals[1] = lsdData.BrakeRF;
+            lsdVals[2] = lsdData.BrakeLR;
+            lsdVals[3] = lsdData.BrakeRR;
+        }
+        return lsdVals;
+    }
 
-    float steerMult = g_settings().Steering.CustomSteering.SteeringMult;
-    if (g_controls.PrevInput == CarControls::InputDevices::Wheel)
-        steerMult = g_settings().Steering.Wheel.SteeringMult;
-    float avgAngle = VExt::GetWheelAverageAngle(g_playerVehicle) * steerMult;
+    void getLSDBrakes(const DrivingAssists::LSDData& lsdData, DrivingAssists::WheelArray<float>& brakeVals) {
+        float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
+        float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
+        float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
+        brakeVals[0] = lsdData.BrakeLF + g_controls.BrakeVal * bbalF * handlingBrakeForce;
+        brakeVals[1] = lsdData.BrakeRF + g_controls.BrakeVal * bbalF * handlingBrakeForce;
+        brakeVals[2] = lsdData.BrakeLR + g_controls.BrakeVal * bbalR * handlingBrakeForce;
+        brakeVals[3] = lsdData.BrakeRR + g_controls.BrakeVal * bbalR * handlingBrakeForce;
+    }
 
-    float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-    float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-    float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
+    void getESPBrakes(const DrivingAssists::ESPData& espData, const DrivingAssists::LSDData& lsdData,
+        DrivingAssists::WheelArray<float>& brakeVals) {
+        float avgAngle = espData.SteerAngle;
 
-    for (auto i = 0; i < g_vehData.mWheelCount; ++i) {
-        g_vehData.mWheelsAbs[i] = false;
-    }
-    float avgAngle_ = -avgAngle;
-    if (espData.OppositeLock) {
-        avgAngle_ = avgAngle;
-    }
-    float oversteerAngleDeg = abs(rad2deg(espData.OversteerAngle));
-    float overMin = g_settings().DriveAssists.ESP.OverMin;
-    float overMax = g_settings().DriveAssists.ESP.OverMax;
-    float overMinComp = g_settings().DriveAssists.ESP.OverMinComp;
-    float overMaxComp = g_settings().DriveAssists.ESP.OverMaxComp;
-    float oversteerComp = map(oversteerAngleDeg,
-        overMin, overMax,
-        overMinComp, overMaxComp);
+        float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
+        float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
+        float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
+        float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
 
-    float oversteerAdd = handlingBrakeForce * oversteerComp;
+        for (auto i = 0; i < g_vehData.mWheelCount; ++i) {
+            g_vehData.mWheelsAbs[i] = false;
+        }
+        float avgAngle_ = -avgAngle;
+        if (espData.OppositeLock) {
+            avgAngle_ = avgAngle;
+        }
+        float oversteerAngleDeg = abs(rad2deg(espData.OversteerAngle));
+        float overMin = g_settings().DriveAssists.ESP.OverMin;
+        float overMax = g_settings().DriveAssists.ESP.OverMax;
+        float overMinComp = g_settings().DriveAssists.ESP.OverMinComp;
+        float overMaxComp = g_settings().DriveAssists.ESP.OverMaxComp;
+        float oversteerComp = map(oversteerAngleDeg,
+            overMin, overMax,
+            overMinComp, overMaxComp);
 
+        float oversteerAdd = handlingBrakeForce * oversteerComp;
 
-    float oversteerRearAdd = handlingBrakeForce * map(
-        oversteerAngleDeg, overMax, overMax * 2.0f,
-        overMinComp, overMaxComp);
-    oversteerRearAdd = std::clamp(oversteerRearAdd, 0.0f, overMaxComp);
+        float oversteerRearAdd = handlingBrakeForce * map(
+            oversteerAngleDeg, overMax, overMax * 2.0f,
+            overMinComp, overMaxComp);
+        oversteerRearAdd = std::clamp(oversteerRearAdd, 0.0f, overMaxComp);
 
-    float understeerAngleDeg(abs(rad2deg(espData.UndersteerAngle)));
+        float understeerAngleDeg(abs(rad2deg(espData.UndersteerAngle)));
 
-    float underMin = g_settings().DriveAssists.ESP.UnderMin;
-    float underMax = g_settings().DriveAssists.ESP.UnderMax;
-    float underMinComp = g_settings().DriveAssists.ESP.UnderMinComp;
-    float underMaxComp = g_settings().DriveAssists.ESP.UnderMaxComp;
+        float underMin = g_settings().DriveAssists.ESP.UnderMin;
+        float underMax = g_settings().DriveAssists.ESP.UnderMax;
+        float underMinComp = g_settings().DriveAssists.ESP.UnderMinComp;
+        float underMaxComp = g_settings().DriveAssists.ESP.UnderMaxComp;
 
-    float understeerComp = map(understeerAngleDeg,
-        underMin, underMax,
-        underMinComp, underMaxComp);
+        float understeerComp = map(understeerAngleDeg,
+            underMin, underMax,
+            underMinComp, underMaxComp);
 
-    float understeerAdd = handlingBrakeForce * understeerComp;
+        float understeerAdd = handlingBrakeForce * understeerComp;
 
-    float brkFBase = inpBrakeForce * bbalF;
-    brakeVals[0] = brkFBase + (avgAngle_ < 0.0f && espData.Oversteer ? oversteerAdd : 0.0f) + lsdData.BrakeLF;
-    brakeVals[1] = brkFBase + (avgAngle_ > 0.0f && espData.Oversteer ? oversteerAdd : 0.0f) + lsdData.BrakeRF;
+        float brkFBase = inpBrakeForce * bbalF;
+        brakeVals[0] = brkFBase + (avgAngle_ < 0.0f && espData.Oversteer ? oversteerAdd : 0.0f) + lsdData.BrakeLF;
+        brakeVals[1] = brkFBase + (avgAngle_ > 0.0f && espData.Oversteer ? oversteerAdd : 0.0f) + lsdData.BrakeRF;
 
-    float brkRBase = inpBrakeForce * bbalR;
-    float brkRUnderL = (avgAngle > 0.0f && espData.Understeer ? understeerAdd : 0.0f);
-    float brkRUnderR = (avgAngle < 0.0f && espData.Understeer ? understeerAdd : 0.0f);
+        float brkRBase = inpBrakeForce * bbalR;
+        float brkRUnderL = (avgAngle > 0.0f && espData.Understeer ? understeerAdd : 0.0f);
+        float brkRUnderR = (avgAngle < 0.0f && espData.Understeer ? understeerAdd : 0.0f);
 
-    float brkROverL = (avgAngle_ < 0.0f && espData.Oversteer ? oversteerRearAdd : 0.0f);
-    float brkROverR = (avgAngle_ > 0.0f && espData.Oversteer ? oversteerRearAdd : 0.0f);
+        float brkROverL = (avgAngle_ < 0.0f && espData.Oversteer ? oversteerRearAdd : 0.0f);
+        float brkROverR = (avgAngle_ > 0.0f && espData.Oversteer ? oversteerRearAdd : 0.0f);
 
-    brakeVals[2] = brkRBase + brkRUnderL + brkROverL + lsdData.BrakeLR;
-    brakeVals[3] = brkRBase + brkRUnderR + brkROverR + lsdData.BrakeRR;
+        brakeVals[2] = brkRBase + brkRUnderL + brkROverL + lsdData.BrakeLR;
+        brakeVals[3] = brkRBase + brkRUnderR + brkROverR + lsdData.BrakeRR;
 
-    g_vehData.mWheelsEspO[0] = avgAngle_ < 0.0f && espData.Oversteer ? true : false;
-    g_vehData.mWheelsEspO[1] = avgAngle_ > 0.0f && espData.Oversteer ? true : false;
-    g_vehData.mWheelsEspU[2] = avgAngle > 0.0f && espData.Understeer ? true : false;
-    g_vehData.mWheelsEspU[3] = avgAngle < 0.0f && espData.Understeer ? true : false;
+        g_vehData.mWheelsEspO[0] = avgAngle_ < 0.0f && espData.Oversteer;
+        g_vehData.mWheelsEspO[1] = avgAngle_ > 0.0f && espData.Oversteer;
+        g_vehData.mWheelsEspU[2] = avgAngle > 0.0f && espData.Understeer;
+        g_vehData.mWheelsEspU[3] = avgAngle < 0.0f && espData.Understeer;
 
-    g_vehData.mWheelsEspO[2] = avgAngle_ < 0.0f && oversteerRearAdd > 0.0f ? true : false;
-    g_vehData.mWheelsEspO[3] = avgAngle_ > 0.0f && oversteerRearAdd > 0.0f ? true : false;
+        g_vehData.mWheelsEspO[2] = avgAngle_ < 0.0f && oversteerRearAdd > 0.0f;
+        g_vehData.mWheelsEspO[3] = avgAngle_ > 0.0f && oversteerRearAdd > 0.0f;
+    }
 
-    return brakeVals;
-}
+    void getTCSBrakes(const DrivingAssists::WheelBlock& wheels, const DrivingAssists::TCSData& tcsData,
+        const DrivingAssists::LSDData& lsdData, DrivingAssists::WheelArray<float>& brakeVals) {
+        auto lsdVals = getLSDVals(wheels, lsdData);
+
+        float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
+        float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
+
+        // Both sides are evaluated for every wheel, so this compiles to a select.
+        for (uint8_t i = 0; i < wheels.Count; i++) {
+            float slipBrake = map(
+                wheels.TyreSpeed[i],
+                wheels.VelocityY,
+                wheels.VelocityY + 2.5f, 0.0f, 0.5f) + lsdVals[i];
+            float inputBrake = inpBrakeForce + lsdVals[i];
+            brakeVals[i] = tcsData.SlippingWheels[i] ? slipBrake : inputBrake;
+            g_vehData.mWheelsTcs[i] = tcsData.SlippingWheels[i];
+        }
+    }
 
-std::vector<float> DrivingAssists::GetTCSBrakes(TCSData tcsData, LSDData lsdData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount);
-    std::vector<float> lsdVals(g_vehData.mWheelCount);
+    void getABSBrakes(const DrivingAssists::WheelBlock& wheels, const DrivingAssists::ABSData& absData,
+        const DrivingAssists::LSDData& lsdData, DrivingAssists::WheelArray<float>& brakeVals) {
+        auto lsdVals = getLSDVals(wheels, lsdData);
 
-    float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
+        float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
+        float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
 
-    if (g_vehData.mWheelCount == 4) {
-        lsdVals = {
-           lsdData.BrakeLF,
-           lsdData.BrakeRF,
-           lsdData.BrakeLR,
-           lsdData.BrakeRR,
-        };
+        for (uint8_t i = 0; i < wheels.Count; i++) {
+            brakeVals[i] = inpBrakeForce * absData.Pressure[i] + lsdVals[i];
+            g_vehData.mWheelsAbs[i] = absData.Pressure[i] < 1.0f;
+        }
     }
+}
 
-    for (int i = 0; i < g_vehData.mWheelCount; i++) {
-        if (tcsData.SlippingWheels[i]) {
-            brakeVals[i] = map(
-                g_vehData.mWheelTyreSpeeds[i],
-                g_vehData.mVelocity.y,
-                g_vehData.mVelocity.y + 2.5f, 0.0f, 0.5f) + lsdVals[i];
-            g_vehData.mWheelsTcs[i] = true;
-        }
-        else {
-            brakeVals[i] = inpBrakeForce + lsdVals[i];
-            g_vehData.mWheelsTcs[i] = false;
-        }
+DrivingAssists::WheelBlock DrivingAssists::GetWheelBlock() {
+    WheelBlock wheels{};
+    wheels.Count = std::min(g_vehData.mWheelCount, MaxWheels);
+
+    // Power is written to by other features earlier in the tick, so
+    // it's the only per-wheel value that's read here directly.
+    auto power = VExt::GetWheelPower(g_playerVehicle);
+
+    for (uint8_t i = 0; i < wheels.Count; ++i) {
+        wheels.TyreSpeed[i] = g_vehData.mWheelTyreSpeeds[i];
+        wheels.SuspensionTravel[i] = g_vehData.mSuspensionTravel[i];
+        wheels.Power[i] = i < power.size() ? power[i] : 0.0f;
+        wheels.RotationSpeed[i] = g_vehData.mWheelRotationSpeeds[i];
+        wheels.Driven[i] = g_vehData.mWheelsDriven[i];
     }
 
-    return brakeVals;
+    wheels.VelocityY = g_vehData.mVelocity.y;
+    wheels.AverageDrivenTyreSpeed = g_vehData.mWheelAverageDrivenTyreSpeed;
+    wheels.Throttle = g_vehData.mThrottle;
+    // Rolling backwards, the throttle pedal is what brakes.
+    wheels.Brake = wheels.VelocityY < 0.0f ? g_controls.ThrottleVal : g_controls.BrakeVal;
+    wheels.Clutch = g_vehData.mClutch;
+    wheels.Handbrake = VExt::GetHandbrake(g_playerVehicle);
+    wheels.Burnout = VEHICLE::IS_VEHICLE_IN_BURNOUT(g_playerVehicle);
+    return wheels;
 }
 
-std::vector<float> DrivingAssists::GetABSBrakes(ABSData absData, LSDData lsdData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount);
-    std::vector<float> lsdVals(g_vehData.mWheelCount);
+DrivingAssists::AssistData DrivingAssists::Evaluate(const WheelBlock& wheels) {
+    AssistData assists{};
 
-    float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    float inpBrakeForce = handlingBrakeForce * g_controls.BrakeVal;
+    const bool tcsEnable = g_settings().DriveAssists.TCS.Enable;
+    const float slipLimit = wheels.VelocityY + g_settings().DriveAssists.TCS.SlipMax;
 
-    if (g_vehData.mWheelCount == 4) {
-        lsdVals = {
-            lsdData.BrakeLF,
-            lsdData.BrakeRF,
-            lsdData.BrakeLR,
-            lsdData.BrakeRR,
-        };
+    bool tractionLoss = false;
+    WheelArray<uint8_t> braked{};
+
+    // Single pass for all per-wheel conditions. Non-short-circuiting
+    // operators on purpose, so the loop body has no branches.
+    for (uint8_t i = 0; i < wheels.Count; i++) {
+        bool grounded = wheels.SuspensionTravel[i] > 0.0f;
+
+        bool slipped = tcsEnable &
+            (wheels.TyreSpeed[i] > slipLimit) &
+            grounded &
+            (wheels.Driven[i] != 0) &
+            (wheels.Power[i] > 0.1f);
+
+        // Brake input, not pressure: pressure is what the controller modulates.
+        braked[i] = grounded & (wheels.Brake > 0.0f);
+        assists.TCS.SlippingWheels[i] = slipped;
+        tractionLoss |= slipped;
     }
 
-    for (uint8_t i = 0; i < g_vehData.mWheelsLockedUp.size(); i++) {
-        if (g_vehData.mWheelsLockedUp[i]) {
-            brakeVals[i] = 0.0f + lsdVals[i];
-            g_vehData.mWheelsAbs[i] = true;
-        }
-        else {
-            brakeVals[i] = inpBrakeForce + lsdVals[i];
-            g_vehData.mWheelsAbs[i] = false;
-        }
+    bool absNativePresent = g_vehData.mHasABS && g_settings().DriveAssists.ABS.Filter;
+    bool absEnable = g_settings().DriveAssists.ABS.Enable && !absNativePresent &&
+        !wheels.Handbrake && !wheels.Burnout;
+
+    if (absVehicle != g_playerVehicle) {
+        absController.Reset();
+        absVehicle = g_playerVehicle;
     }
 
-    return brakeVals;
+    // The controller keeps its own fixed-step clock, feed it the frame time
+    // even when disabled so the wheels fall back to full pressure.
+    if (!absEnable) {
+        braked.fill(0);
+    }
+    absController.Update(MISC::GET_FRAME_TIME(), wheels.VelocityY,
+        wheels.TyreSpeed.data(), braked.data(), wheels.Count);
+
+    for (uint8_t i = 0; i < wheels.Count; i++) {
+        assists.ABS.Pressure[i] = absController.Wheel(i).Pressure;
+    }
+
+    if (wheels.Handbrake || wheels.Burnout) {
+        tractionLoss = false;
+    }
+
+    assists.ABS.Use = absEnable && absController.Modulating();
+    assists.TCS.Use = tcsEnable && tractionLoss;
+    assists.ESP = dynamics.ESP;
+    assists.LSD = getLSD(wheels);
+
+    lastAssists = assists;
+    return assists;
 }
 
-std::vector<float> DrivingAssists::GetLSDBrakes(LSDData lsdData) {
-    std::vector<float> brakeVals(g_vehData.mWheelCount); // only works for 4 wheels but ok
+void DrivingAssists::UpdateDynamics() {
+    dynamics.Speed = EntityCache::GetSpeed(g_playerVehicle);
+    dynamics.SpeedVector = g_vehData.mVelocity;
+    dynamics.RotationVelocity = EntityCache::GetRotationVelocity(g_playerVehicle);
+    dynamics.YawRate = dynamics.RotationVelocity.z;
+
+    bool anyWheelOnGround = false;
+    for (bool value : g_vehData.mWheelsOnGround) {
+        anyWheelOnGround |= value;
+    }
+    dynamics.ESP = getESP(dynamics, anyWheelOnGround);
+}
 
-    float handlingBrakeForce = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeForce);
-    float bbalF = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasFront);
-    float bbalR = *reinterpret_cast<float*>(g_vehData.mHandlingPtr + hOffsets.fBrakeBiasRear);
-    brakeVals[0] = lsdData.BrakeLF + g_controls.BrakeVal * bbalF * handlingBrakeForce;
-    brakeVals[1] = lsdData.BrakeRF + g_controls.BrakeVal * bbalF * handlingBrakeForce;
-    brakeVals[2] = lsdData.BrakeLR + g_controls.BrakeVal * bbalR * handlingBrakeForce;
-    brakeVals[3] = lsdData.BrakeRR + g_controls.BrakeVal * bbalR * handlingBrakeForce;
+const DrivingAssists::DynamicsState& DrivingAssists::GetDynamics() {
+    return dynamics;
+}
+
+const DrivingAssists::AssistData& DrivingAssists::GetAssists() {
+    return lastAssists;
+}
+
+DrivingAssists::WheelArray<float> DrivingAssists::GetBrakes(const AssistData& assists, const WheelBlock& wheels) {
+    WheelArray<float> brakeVals{};
+
+    if (assists.LSD.Use) {
+        getLSDBrakes(assists.LSD, brakeVals);
+    }
+    if (assists.ESP.Use) {
+        getESPBrakes(assists.ESP, assists.LSD, brakeVals);
+    }
+    if (assists.TCS.Use && g_settings().DriveAssists.TCS.Mode == 0) {
+        getTCSBrakes(wheels, assists.TCS, assists.LSD, brakeVals);
+    }
+    if (assists.ABS.Use) {
+        getABSBrakes(wheels, assists.ABS, assists.LSD, brakeVals);
+    }
 
     return brakeVals;
 }
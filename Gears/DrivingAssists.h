@@ -1,14 +1,44 @@
 #pragma once
-#include <vector>
+#include "SlipController.h"
+#include <inc/types.h>
+#include <array>
+#include <cstdint>
 
 namespace DrivingAssists {
+    // More than any vehicle in the game has, extra wheels are ignored.
+    constexpr uint8_t MaxWheels = 10;
+
+    template <typename T>
+    using WheelArray = std::array<T, MaxWheels>;
+
+    // Per-wheel inputs for the assists, gathered once per tick.
+    // Kept as plain arrays so the per-wheel passes stay branchless.
+    struct WheelBlock {
+        uint8_t Count;
+        WheelArray<float> TyreSpeed;
+        WheelArray<float> SuspensionTravel;
+        WheelArray<float> Power;
+        WheelArray<float> RotationSpeed;
+        WheelArray<uint8_t> Driven;
+
+        float VelocityY;
+        float AverageDrivenTyreSpeed;
+        float Throttle;
+        float Brake;                // Braking input for the direction of travel
+        float Clutch;
+        bool Handbrake;
+        bool Burnout;
+    };
+
     struct ABSData {
         bool Use;
+        // Brake pressure multiplier from the slip controller, per wheel
+        WheelArray<float> Pressure;
     };
 
     struct TCSData {
         bool Use;
-        std::vector<bool> SlippingWheels;
+        WheelArray<bool> SlippingWheels;
     };
 
     struct ESPData {
@@ -26,8 +56,13 @@ namespace DrivingAssists {
         // average rear wheels slip angle
         float OversteerAngle; // rad
         bool OppositeLock;
+
+        // average steered wheel angle, with steering multiplier
+        float SteerAngle; // rad
     };
 
+    // Technically not an assist since the ESP-ish "braked wheel sends power to the other side"
+    // doesn't apply, but putting it here anyway since we negative-brake to simulate power transfer.
     struct LSDData {
         bool Use;
         float BrakeLF;
@@ -38,16 +73,38 @@ namespace DrivingAssists {
         float RDD; // debug, rear  diff speeddiff
     };
 
-    ABSData GetABS();
-    TCSData GetTCS();
-    ESPData GetESP();
+    // Vehicle motion shared by the assists, AWD and FFB.
+    // Filled once per tick by UpdateDynamics.
+    struct DynamicsState {
+        float Speed;                // m/s
+        Vector3 SpeedVector;        // m/s, vehicle-relative
+        Vector3 RotationVelocity;   // rad/s
+        float YawRate;              // rad/s
+        ESPData ESP;
+    };
 
-    // Technically not an assist since the ESP-ish "braked wheel sends power to the other side"
-    // doesn't apply, but putting it here anyway since we negative-brake to simulate power transfer.
-    LSDData GetLSD();
+    struct AssistData {
+        ABSData ABS;
+        TCSData TCS;
+        ESPData ESP;
+        LSDData LSD;
+    };
+
+    // Call once per tick, after g_vehData has been updated.
+    void UpdateDynamics();
+    const DynamicsState& GetDynamics();
+
+    // Snapshot of the player vehicle wheels, mostly from g_vehData.
+    WheelBlock GetWheelBlock();
+
+    // Evaluates ABS, TCS, ESP and LSD in one pass over the wheel block.
+    // Advances the ABS slip controller, so call once per tick.
+    AssistData Evaluate(const WheelBlock& wheels);
+
+    // Result of the last Evaluate(), for display.
+    const AssistData& GetAssists();
 
-    std::vector<float> GetESPBrakes(ESPData espData, LSDData lsdData);
-    std::vector<float> GetTCSBrakes(TCSData tcsData, LSDData lsdData);
-    std::vector<float> GetABSBrakes(ABSData absData, LSDData lsdData);
-    std::vector<float> GetLSDBrakes(LSDData lsdData);
+    // Final per-wheel brake pressures for the active assists.
+    // Priority (last wins): LSD, ESP, TCS (brake mode), ABS.
+    WheelArray<float> GetBrakes(const AssistData& assists, const WheelBlock& wheels);
 }
@@ -45,12 +45,22 @@ CarControls::CarControls()
     : PrevInput(Keyboard)
     , mXInputController(1) {
     std::fill(ControlXboxBlocks.begin(), ControlXboxBlocks.end(), -1);
+    std::fill(mAxisBindings.begin(), mAxisBindings.end(),
+        SAxisBinding{ GUID_NULL, -1, WheelDirectInput::UNKNOWN_AXIS, 0.0f, 0.0f });
+    std::fill(mButtonBindings.begin(), mButtonBindings.end(),
+        SButtonBinding{ GUID_NULL, -1, -1 });
+    std::fill(mXboxBindings.begin(), mXboxBindings.end(), XInputController::UNKNOWN);
 }
 
 CarControls::~CarControls() = default;
 
 void CarControls::InitWheel() {
-    if (!mWheelInput.InitWheel()) {
+    bool initialized = mWheelInput.InitWheel();
+
+    // Device slots changed, even if nothing was found.
+    CompileBindings();
+
+    if (!initialized) {
         // Initialization failed somehow, so we skip
         return;
     }
@@ -60,14 +70,50 @@ void CarControls::InitWheel() {
 
 void CarControls::InitFFB() {
 
-    auto steerGUID = WheelAxes[static_cast<int>(WheelAxisType::Steer)].Guid;
-    auto ffAxis = mWheelInput.StringToAxis(WheelAxes[static_cast<int>(WheelAxisType::ForceFeedback)].Control);
+    auto steerGUID = mAxisBindings[static_cast<int>(WheelAxisType::Steer)].Guid;
+    auto ffAxis = mAxisBindings[static_cast<int>(WheelAxisType::ForceFeedback)].Axis;
 
     if (mWheelInput.InitFFB(steerGUID, ffAxis)) {
         mWheelInput.UpdateCenterSteering(steerGUID, ffAxis);
     }
 }
 
+void CarControls::CompileBindings() {
+    const std::array<std::pair<int, int>, static_cast<int>(WheelAxisType::SIZEOF_WheelAxisType)> calibration{
+        std::pair{ g_settings.Wheel.Throttle.Min, g_settings.Wheel.Throttle.Max },
+        std::pair{ g_settings.Wheel.Brake.Min, g_settings.Wheel.Brake.Max },
+        std::pair{ g_settings.Wheel.Clutch.Min, g_settings.Wheel.Clutch.Max },
+        std::pair{ g_settings.Wheel.Steering.Min, g_settings.Wheel.Steering.Max },
+        std::pair{ g_settings.Wheel.HandbrakeA.Min, g_settings.Wheel.HandbrakeA.Max },
+        // Force feedback is an output, it has no calibration.
+        std::pair{ 0, 0 },
+    };
+
+    for (size_t i = 0; i < WheelAxes.size(); ++i) {
+        const auto& input = WheelAxes[i];
+        mAxisBindings[i] = SAxisBinding{
+            input.Guid,
+            mWheelInput.FindSlotFromGUID(input.Guid),
+            mWheelInput.StringToAxis(input.Control),
+            static_cast<float>(calibration[i].first),
+            static_cast<float>(calibration[i].second),
+        };
+    }
+
+    for (size_t i = 0; i < WheelButton.size(); ++i) {
+        const auto& input = WheelButton[i];
+        mButtonBindings[i] = SButtonBinding{
+            input.Guid,
+            mWheelInput.FindSlotFromGUID(input.Guid),
+            input.Control,
+        };
+    }
+
+    for (size_t i = 0; i < ControlXbox.size(); ++i) {
+        mXboxBindings[i] = mXInputController.StringToButton(ControlXbox[i].Control);
+    }
+}
+
 void CarControls::updateKeyboard() {
     ThrottleVal = IsKeyPressed(KBControl[static_cast<int>(KeyboardControlType::Throttle)].Control) ? 1.0f : 0.0f;
     BrakeVal = IsKeyPressed(KBControl[static_cast<int>(KeyboardControlType::Brake)].Control) ? 1.0f : 0.0f;
@@ -80,25 +126,24 @@ void CarControls::updateController() {
         BrakeVal = mNativeController.GetAnalogValue(LegacyControls[static_cast<int>(LegacyControlType::Brake)].Control);
         ClutchVal = mNativeController.GetAnalogValue(LegacyControls[static_cast<int>(LegacyControlType::Clutch)].Control);
     } else {
-        ThrottleVal = mXInputController.GetAnalogValue(mXInputController.StringToButton(ControlXbox[static_cast<int>(ControllerControlType::Throttle)].Control));
-        BrakeVal = mXInputController.GetAnalogValue(mXInputController.StringToButton(ControlXbox[static_cast<int>(ControllerControlType::Brake)].Control));
-        ClutchVal = mXInputController.GetAnalogValue(mXInputController.StringToButton(ControlXbox[static_cast<int>(ControllerControlType::Clutch)].Control));
+        ThrottleVal = mXInputController.GetAnalogValue(mXboxBindings[static_cast<int>(ControllerControlType::Throttle)]);
+        BrakeVal = mXInputController.GetAnalogValue(mXboxBindings[static_cast<int>(ControllerControlType::Brake)]);
+        ClutchVal = mXInputController.GetAnalogValue(mXboxBindings[static_cast<int>(ControllerControlType::Clutch)]);
 
-        SteerVal = mXInputController.GetAnalogValue(mXInputController.StringToButton(ControlXbox[static_cast<int>(ControllerControlType::SteerLeft)].Control),  g_settings.Controller.CustomDeadzone) -
-                   mXInputController.GetAnalogValue(mXInputController.StringToButton(ControlXbox[static_cast<int>(ControllerControlType::SteerRight)].Control), g_settings.Controller.CustomDeadzone);
+        SteerVal = mXInputController.GetAnalogValue(mXboxBindings[static_cast<int>(ControllerControlType::SteerLeft)],  g_settings.Controller.CustomDeadzone) -
+                   mXInputController.GetAnalogValue(mXboxBindings[static_cast<int>(ControllerControlType::SteerRight)], g_settings.Controller.CustomDeadzone);
     }
 }
 
 // analog > button
-float CarControls::getInputValue(WheelAxisType axisType, WheelControlType buttonType, float minRaw, float maxRaw) {
+float CarControls::getInputValue(WheelAxisType axisType, WheelControlType buttonType) {
     float inputValue;
-    auto axis = mWheelInput.StringToAxis(WheelAxes[static_cast<int>(axisType)].Control);
-    auto axisGUID = WheelAxes[static_cast<int>(axisType)].Guid;
+    const auto& binding = mAxisBindings[static_cast<int>(axisType)];
 
-    int axisValue = mWheelInput.GetAxisValue(axis, axisGUID);
+    int axisValue = mWheelInput.GetAxisValue(binding.Axis, binding.Slot);
 
     if (axisValue != -1) {
-        inputValue = map(static_cast<float>(axisValue), minRaw, maxRaw, 0.0f, 1.0f);
+        inputValue = map(static_cast<float>(axisValue), binding.Min, binding.Max, 0.0f, 1.0f);
     }
     else {
         inputValue = ButtonIn(buttonType) ? 1.0f : 0.0f;
@@ -130,16 +175,11 @@ float CarControls::filterDeadzone(float input, float deadzone, float deadzoneOff
 }
 
 void CarControls::updateWheel() {
-    ThrottleVal = getInputValue(WheelAxisType::Throttle, WheelControlType::Throttle, 
-        static_cast<float>(g_settings.Wheel.Throttle.Min), static_cast<float>(g_settings.Wheel.Throttle.Max));
-    BrakeVal = getInputValue(WheelAxisType::Brake, WheelControlType::Brake, 
-        static_cast<float>(g_settings.Wheel.Brake.Min), static_cast<float>(g_settings.Wheel.Brake.Max));
-    ClutchVal = getInputValue(WheelAxisType::Clutch, WheelControlType::Clutch, 
-        static_cast<float>(g_settings.Wheel.Clutch.Min), static_cast<float>(g_settings.Wheel.Clutch.Max));
-    HandbrakeVal = getInputValue(WheelAxisType::Handbrake, WheelControlType::Handbrake, 
-        static_cast<float>(g_settings.Wheel.HandbrakeA.Min), static_cast<float>(g_settings.Wheel.HandbrakeA.Max));
-    SteerValRaw = getInputValue(WheelAxisType::Steer, WheelControlType::UNKNOWN, 
-        static_cast<float>(g_settings.Wheel.Steering.Min), static_cast<float>(g_settings.Wheel.Steering.Max));
+    ThrottleVal = getInputValue(WheelAxisType::Throttle, WheelControlType::Throttle);
+    BrakeVal = getInputValue(WheelAxisType::Brake, WheelControlType::Brake);
+    ClutchVal = getInputValue(WheelAxisType::Clutch, WheelControlType::Clutch);
+    HandbrakeVal = getInputValue(WheelAxisType::Handbrake, WheelControlType::Handbrake);
+    SteerValRaw = getInputValue(WheelAxisType::Steer, WheelControlType::UNKNOWN);
     SteerVal = filterDeadzone(SteerValRaw, g_settings.Wheel.Steering.DeadZone, g_settings.Wheel.Steering.DeadZoneOffset);
 }
 
@@ -200,9 +240,9 @@ CarControls::InputDevices CarControls::GetLastInputDevice(InputDevices previousI
     } 
     else {
         auto cThrottleIdx = static_cast<int>(ControllerControlType::Throttle);
-        auto cThrottleBtn = mXInputController.StringToButton(ControlXbox[cThrottleIdx].Control);
+        auto cThrottleBtn = mXboxBindings[cThrottleIdx];
         auto cBrakeIdx = static_cast<int>(ControllerControlType::Brake);
-        auto cBrakeBtn = mXInputController.StringToButton(ControlXbox[cBrakeIdx].Control);
+        auto cBrakeBtn = mXboxBindings[cBrakeIdx];
         if (mXInputController.IsButtonJustPressed(cThrottleBtn) ||
             mXInputController.IsButtonPressed(cThrottleBtn) ||
             mXInputController.IsButtonJustPressed(cBrakeBtn) ||
@@ -210,13 +250,10 @@ CarControls::InputDevices CarControls::GetLastInputDevice(InputDevices previousI
             return Controller;
         }
     }
-    if (enableWheel && mWheelInput.IsConnected(WheelAxes[static_cast<int>(WheelAxisType::Steer)].Guid)) {
-        float throttleVal = getInputValue(WheelAxisType::Throttle, WheelControlType::Throttle, 
-            static_cast<float>(g_settings.Wheel.Throttle.Min), static_cast<float>(g_settings.Wheel.Throttle.Max));
-        float brakeVal = getInputValue(WheelAxisType::Brake, WheelControlType::Brake, 
-            static_cast<float>(g_settings.Wheel.Brake.Min), static_cast<float>(g_settings.Wheel.Brake.Max));
-        float clutchVal = getInputValue(WheelAxisType::Clutch, WheelControlType::Clutch, 
-            static_cast<float>(g_settings.Wheel.Clutch.Min), static_cast<float>(g_settings.Wheel.Clutch.Max));
+    if (enableWheel && WheelAvailable()) {
+        float throttleVal = getInputValue(WheelAxisType::Throttle, WheelControlType::Throttle);
+        float brakeVal = getInputValue(WheelAxisType::Brake, WheelControlType::Brake);
+        float clutchVal = getInputValue(WheelAxisType::Clutch, WheelControlType::Clutch);
 
         if (throttleVal > 0.5f ||
             brakeVal > 0.5f ||
@@ -258,35 +295,35 @@ bool CarControls::ButtonJustPressed(KeyboardControlType control) {
 
 bool CarControls::ButtonJustPressed(ControllerControlType control) {
     return mXInputController.IsButtonJustPressed(
-        mXInputController.StringToButton(ControlXbox[static_cast<int>(control)].Control));
+        mXboxBindings[static_cast<int>(control)]);
 }
 
 bool CarControls::ButtonReleased(ControllerControlType control) {
     return mXInputController.IsButtonJustReleased(
-        mXInputController.StringToButton(ControlXbox[static_cast<int>(control)].Control));
+        mXboxBindings[static_cast<int>(control)]);
 }
 
 bool CarControls::ButtonReleasedAfter(ControllerControlType control, int time) {
     return mXInputController.WasButtonHeldForMs(
-        mXInputController.StringToButton(ControlXbox[static_cast<int>(control)].Control), time);
+        mXboxBindings[static_cast<int>(control)], time);
 }
 
 bool CarControls::ButtonHeld(ControllerControlType control) {
     return mXInputController.WasButtonHeldForMs(
-        mXInputController.StringToButton(ControlXbox[static_cast<int>(control)].Control), g_settings.Controller.HoldTimeMs);
+        mXboxBindings[static_cast<int>(control)], g_settings.Controller.HoldTimeMs);
 }
 
 bool CarControls::ButtonHeldOver(ControllerControlType control, int millis) {
     return mXInputController.WasButtonHeldOverMs(
-        mXInputController.StringToButton(ControlXbox[static_cast<int>(control)].Control), millis);
+        mXboxBindings[static_cast<int>(control)], millis);
 }
 
 XInputController::TapState CarControls::ButtonTapped(ControllerControlType control) {
-    return mXInputController.WasButtonTapped(mXInputController.StringToButton(ControlXbox[static_cast<int>(control)].Control), g_settings.Controller.MaxTapTimeMs);
+    return mXInputController.WasButtonTapped(mXboxBindings[static_cast<int>(control)], g_settings.Controller.MaxTapTimeMs);
 }
 
 bool CarControls::ButtonIn(ControllerControlType control) {
-    return mXInputController.IsButtonPressed(mXInputController.StringToButton(ControlXbox[static_cast<int>(control)].Control));
+    return mXInputController.IsButtonPressed(mXboxBindings[static_cast<int>(control)]);
 }
 
 /*
@@ -338,43 +375,39 @@ bool CarControls::ButtonReleasedAfter(LegacyControlType control, int time) {
  */
 
 bool CarControls::ButtonJustPressed(WheelControlType control) {
-    if (!mWheelInput.IsConnected(WheelButton[static_cast<int>(control)].Guid) ||
-        WheelButton[static_cast<int>(control)].Control == -1) {
+    const auto& binding = mButtonBindings[static_cast<int>(control)];
+    if (binding.Slot == -1 || binding.Button == -1) {
         return false;
     }
-    return mWheelInput.IsButtonJustPressed(WheelButton[static_cast<int>(control)].Control,
-                                           WheelButton[static_cast<int>(control)].Guid);
+    return mWheelInput.IsButtonJustPressed(binding.Button, binding.Guid);
 }
 
 bool CarControls::ButtonReleased(WheelControlType control) {
-    if (!mWheelInput.IsConnected(WheelButton[static_cast<int>(control)].Guid) ||
-        WheelButton[static_cast<int>(control)].Control == -1) {
+    const auto& binding = mButtonBindings[static_cast<int>(control)];
+    if (binding.Slot == -1 || binding.Button == -1) {
         return false;
     }
-    return mWheelInput.IsButtonJustReleased(WheelButton[static_cast<int>(control)].Control,
-                                            WheelButton[static_cast<int>(control)].Guid);
+    return mWheelInput.IsButtonJustReleased(binding.Button, binding.Guid);
 }
 
 bool CarControls::ButtonHeld(WheelControlType control, int delay) {
-    if (!mWheelInput.IsConnected(WheelButton[static_cast<int>(control)].Guid) ||
-        WheelButton[static_cast<int>(control)].Control == -1) {
+    const auto& binding = mButtonBindings[static_cast<int>(control)];
+    if (binding.Slot == -1 || binding.Button == -1) {
         return false;
     }
-    return mWheelInput.WasButtonHeldForMs(WheelButton[static_cast<int>(control)].Control,
-                                          WheelButton[static_cast<int>(control)].Guid, delay);
+    return mWheelInput.WasButtonHeldForMs(binding.Button, binding.Guid, delay);
 }
 
 bool CarControls::ButtonIn(WheelControlType control) {
-    if (!mWheelInput.IsConnected(WheelButton[static_cast<int>(control)].Guid) ||
-        WheelButton[static_cast<int>(control)].Control == -1) {
+    const auto& binding = mButtonBindings[static_cast<int>(control)];
+    if (binding.Slot == -1 || binding.Button == -1) {
         return false;
     }
-    return mWheelInput.IsButtonPressed(WheelButton[static_cast<int>(control)].Control,
-                                       WheelButton[static_cast<int>(control)].Guid);
+    return mWheelInput.IsButtonPressed(binding.Button, binding.Guid);
 }
 
 void CarControls::CheckCustomButtons() {
-    if (!mWheelInput.IsConnected(WheelAxes[static_cast<int>(WheelAxisType::Steer)].Guid)) {
+    if (!WheelAvailable()) {
         return;
     }
     for (int i = 0; i < MAX_RGBBUTTONS; i++) {
@@ -470,32 +503,36 @@ void CarControls::CheckGUIDs(const std::vector<_GUID> & guids) {
 }
 
 void CarControls::PlayFFBDynamics(int totalForce, int damperForce) {
-    auto ffbCtrl = WheelAxes[static_cast<int>(WheelAxisType::ForceFeedback)];
-    auto axis = mWheelInput.StringToAxis(ffbCtrl.Control);
-    mWheelInput.SetConstantForce(ffbCtrl.Guid, axis, totalForce);
-    mWheelInput.SetDamper(ffbCtrl.Guid, axis, damperForce);
+    const auto& ffb = mAxisBindings[static_cast<int>(WheelAxisType::ForceFeedback)];
+    if (ffb.Slot == -1)
+        return;
+    mWheelInput.SetConstantForce(ffb.Guid, ffb.Axis, totalForce);
+    mWheelInput.SetDamper(ffb.Guid, ffb.Axis, damperForce);
 }
 
 void CarControls::PlayFFBCollision(int collisionForce) {
-    auto ffbCtrl = WheelAxes[static_cast<int>(WheelAxisType::ForceFeedback)];
-    auto axis = mWheelInput.StringToAxis(ffbCtrl.Control);
-    mWheelInput.SetCollision(ffbCtrl.Guid, axis, collisionForce);
+    const auto& ffb = mAxisBindings[static_cast<int>(WheelAxisType::ForceFeedback)];
+    if (ffb.Slot == -1)
+        return;
+    mWheelInput.SetCollision(ffb.Guid, ffb.Axis, collisionForce);
 }
 
 void CarControls::PlayLEDs(float rpm, float firstLed, float lastLed) {
-    auto ctrl = WheelAxes[static_cast<int>(WheelAxisType::Steer)];
-    mWheelInput.PlayLedsDInput(ctrl.Guid, rpm, firstLed, lastLed);
+    const auto& steer = mAxisBindings[static_cast<int>(WheelAxisType::Steer)];
+    if (steer.Slot == -1)
+        return;
+    mWheelInput.PlayLedsDInput(steer.Guid, rpm, firstLed, lastLed);
 }
 
 float CarControls::GetAxisSpeed(WheelAxisType axis) {
-    auto ctrl = WheelAxes[static_cast<int>(axis)];
-    auto diAxis = mWheelInput.StringToAxis(ctrl.Control);
-    return mWheelInput.GetAxisSpeed(diAxis, ctrl.Guid);
+    const auto& binding = mAxisBindings[static_cast<int>(axis)];
+    if (binding.Slot == -1 || binding.Axis == WheelDirectInput::UNKNOWN_AXIS)
+        return 0.0f;
+    return mWheelInput.GetAxisSpeed(binding.Axis, binding.Guid);
 }
 
 bool CarControls::WheelAvailable() {
-    auto ctrl = WheelAxes[static_cast<int>(WheelAxisType::Steer)];
-    return mWheelInput.IsConnected(ctrl.Guid);
+    return mAxisBindings[static_cast<int>(WheelAxisType::Steer)].Slot != -1;
 }
 
 WheelDirectInput& CarControls::GetWheel() {
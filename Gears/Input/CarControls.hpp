@@ -159,14 +159,36 @@ public:
         std::string Description;
     };
 
+    // Wheel axis binding, resolved for per-frame reads.
+    struct SAxisBinding {
+        GUID Guid;
+        int Slot;       // Device index in the current enumeration, -1 if not connected
+        WheelDirectInput::DIAxis Axis;
+        float Min;      // Calibrated raw values
+        float Max;
+    };
+
+    // Wheel button binding, resolved for per-frame reads.
+    struct SButtonBinding {
+        GUID Guid;
+        int Slot;       // Device index in the current enumeration, -1 if not connected
+        int Button;     // -1 if not assigned
+    };
+
     CarControls();
     ~CarControls();
 
     void InitWheel();
     void InitFFB();
+
+    // Resolves the configured bindings into the runtime tables, so queries don't
+    // parse strings or look up GUIDs. Call after reading settings and after
+    // the devices have been (re-)enumerated.
+    void CompileBindings();
+
     void updateKeyboard();
     void updateController();
-    float getInputValue(WheelAxisType axisType, WheelControlType buttonType, float minRaw, float maxRaw);
+    float getInputValue(WheelAxisType axisType, WheelControlType buttonType);
     float filterDeadzone(float input, float deadzone, float deadzoneOffset);
     void updateWheel();
     void UpdateValues(InputDevices prevInput, bool skipKeyboardInput);
@@ -246,6 +268,10 @@ private:
     NativeController mNativeController;
     XInputController mXInputController;
 
+    std::array<SAxisBinding, static_cast<int>(WheelAxisType::SIZEOF_WheelAxisType)> mAxisBindings{};
+    std::array<SButtonBinding, static_cast<int>(WheelControlType::SIZEOF_WheelControlType)> mButtonBindings{};
+    std::array<XInputController::XboxButtons, static_cast<int>(ControllerControlType::SIZEOF)> mXboxBindings{};
+
     bool KBControlCurr[static_cast<int>(KeyboardControlType::SIZEOF_KeyboardControlType)] = {};
     bool KBControlPrev[static_cast<int>(KeyboardControlType::SIZEOF_KeyboardControlType)] = {};
 
@@ -184,6 +184,19 @@ void WheelDirectInput::Update() {
     updateAxisSpeed();
 }
 
+int WheelDirectInput::FindSlotFromGUID(GUID guid) {
+    if (guid == GUID_NULL) {
+        return -1;
+    }
+
+    for (int i = 0; i < DIDeviceFactory::Get().GetEntryCount(); i++) {
+        if (guid == DIDeviceFactory::Get().GetEntry(i)->diDeviceInstance.guidInstance) {
+            return i;
+        }
+    }
+    return -1;
+}
+
 bool WheelDirectInput::IsConnected(GUID device) {
     auto e = FindEntryFromGUID(device);
     return e != nullptr;
@@ -545,7 +558,7 @@ void WheelDirectInput::SetCollision(GUID device, DIAxis ffAxis, int force) {
     m_colEffect->Start(1, 0);
 }
 
-WheelDirectInput::DIAxis WheelDirectInput::StringToAxis(std::string &axisString) {
+WheelDirectInput::DIAxis WheelDirectInput::StringToAxis(const std::string &axisString) {
     for (int i = 0; i < SIZEOF_DIAxis; i++) {
         if (axisString == DIAxisHelper[i]) {
             return static_cast<DIAxis>(i);
@@ -556,10 +569,14 @@ WheelDirectInput::DIAxis WheelDirectInput::StringToAxis(std::string &axisString)
 
 // -1 means device not accessible
 int WheelDirectInput::GetAxisValue(DIAxis axis, GUID device) {
-    if (!IsConnected(device)) {
-        return -1;
-    }
-    auto e = FindEntryFromGUID(device);
+    return getAxisValue(axis, FindEntryFromGUID(device));
+}
+
+int WheelDirectInput::GetAxisValue(DIAxis axis, int slot) {
+    return getAxisValue(axis, DIDeviceFactory::Get().GetEntry(slot));
+}
+
+int WheelDirectInput::getAxisValue(DIAxis axis, const DIDevice* e) {
     if (!e)
         return -1;
     switch (axis) {
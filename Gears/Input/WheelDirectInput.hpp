@@ -73,6 +73,9 @@ public:
     bool InitFFB(GUID guid, DIAxis ffAxis);
     void UpdateCenterSteering(GUID guid, DIAxis steerAxis);
     const DIDevice *FindEntryFromGUID(GUID guid);
+    // Index of the device in the current enumeration, -1 if not connected.
+    // Stays valid until the devices are enumerated again in InitWheel().
+    int FindSlotFromGUID(GUID guid);
 
     // Should be called every update()
     void Update();
@@ -88,9 +91,10 @@ public:
     void SetDamper(GUID device, DIAxis ffAxis, int force);
     void SetCollision(GUID device, DIAxis ffAxis, int force);
 
-    DIAxis StringToAxis(std::string& axisString);
+    DIAxis StringToAxis(const std::string& axisString);
 
     int GetAxisValue(DIAxis axis, GUID device);
+    int GetAxisValue(DIAxis axis, int slot);
     float GetAxisSpeed(DIAxis axis, GUID device);
 
     std::vector<GUID> GetGuids();
@@ -98,6 +102,7 @@ public:
 
 private:
     void updateAxisSpeed();
+    int getAxisValue(DIAxis axis, const DIDevice* e);
     void createConstantForceEffect(DWORD axis, int numAxes, DIEFFECT &diEffect);
     void createDamperEffect(DWORD axis, int numAxes, DIEFFECT &diEffect);
     void createCollisionEffect(DWORD axis, int numAxes, DIEFFECT &diEffect);
@@ -4,6 +4,7 @@
 #include "VehicleData.hpp"
 #include "Input/CarControls.hpp"
 #include "Util/MathExt.h"
+#include "Util/EntityCache.h"
 
 #include <inc/enums.h>
 #include <inc/natives.h>
@@ -20,7 +21,7 @@ namespace {
 void LaunchControl::Update(float& clutchVal) {
     if (g_settings().DriveAssists.LaunchControl.Enable &&
         g_vehData.mGearCurr == 1 &&
-        VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        EntityCache::GetEngineRunning(g_playerVehicle)) {
         switch (launchState) {
             case ELCState::Inactive: {
                 //(g_gearStates.FakeNeutral || clutch >= 1.0f || VExt::GetHandbrake(g_playerVehicle)) && )
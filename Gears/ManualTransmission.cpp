@@ -12,13 +12,101 @@
 #include "inc/natives.h"
 #include "inc/types.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <mutex>
+
 extern ScriptSettings g_settings;
 extern CarControls g_controls;
 extern Vehicle g_playerVehicle;
 extern VehicleGearboxStates g_gearStates;
 extern VehicleData g_vehData;
+extern std::mutex g_ignoredVehiclesMutex;
 extern std::vector<Vehicle> g_ignoredVehicles;
 
+namespace {
+    // Seqlock around the published state: odd while it's being written.
+    // Callers may be on other threads, so they retry until they read
+    // the same even sequence before and after copying.
+    std::atomic<uint32_t> stateSequence = 0;
+    MT_StateSnapshot state{};
+    uint64_t stateTick = 0;
+
+    MT_StateSnapshot readState() {
+        MT_StateSnapshot copy;
+        uint32_t begin;
+        uint32_t end;
+        do {
+            begin = stateSequence.load(std::memory_order_acquire);
+            std::memcpy(&copy, &state, sizeof(copy));
+            std::atomic_thread_fence(std::memory_order_acquire);
+            end = stateSequence.load(std::memory_order_relaxed);
+        } while ((begin & 1) != 0 || begin != end);
+        return copy;
+    }
+
+    int getShiftIndicator() {
+        if (!ENTITY::DOES_ENTITY_EXIST(g_playerVehicle)) {
+            // vehData is not initialized yet, so mGearRatios can not be dereferenced.
+            return 0;
+        }
+        float nextGearMinSpeed = 0.0f; // don't care about top gear
+        if (g_gearStates.LockGear < g_vehData.mGearTop) {
+            nextGearMinSpeed = g_settings().AutoParams.NextGearMinRPM * g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_gearStates.LockGear + 1];
+        }
+        float engineLoad = g_controls.ThrottleVal - map(g_vehData.mRPM, 0.2f, 1.0f, 0.0f, 1.0f);
+        bool shiftUpLoad = g_gearStates.LockGear < g_vehData.mGearTop && 
+            engineLoad < g_settings().AutoParams.UpshiftLoad && 
+            g_vehData.mWheelAverageDrivenTyreSpeed > nextGearMinSpeed;
+
+        float currGearMinSpeed = g_settings().AutoParams.CurrGearMinRPM * g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_gearStates.LockGear];
+        bool shiftDownLoad = engineLoad > g_settings().AutoParams.DownshiftLoad || g_vehData.mWheelAverageDrivenTyreSpeed < currGearMinSpeed;
+
+        if (g_gearStates.HitRPMSpeedLimiter || g_gearStates.HitRPMLimiter || shiftUpLoad) {
+            return 1;
+        }
+        if (g_vehData.mGearCurr > 1 && shiftDownLoad) {
+            return 2;
+        }
+        return 0;
+    }
+}
+
+void publishMTState() {
+    MT_StateSnapshot next{};
+    next.Size = sizeof(MT_StateSnapshot);
+    next.Version = MT_STATE_SNAPSHOT_VERSION;
+    next.Tick = ++stateTick;
+
+    next.ManagedVehicle = g_playerVehicle;
+    next.Active = MemoryPatcher::NumGearboxPatched > 0;
+    next.NeutralGear = g_gearStates.FakeNeutral && g_settings.MTOptions.Enable;
+    next.Shifting = g_gearStates.Shifting;
+    next.LookingLeft = g_controls.ButtonIn(CarControls::WheelControlType::LookLeft);
+    next.LookingRight = g_controls.ButtonIn(CarControls::WheelControlType::LookRight);
+    next.LookingBack = g_controls.ButtonIn(CarControls::WheelControlType::LookBack) ||
+        next.LookingLeft && next.LookingRight;
+    next.ShiftMode = static_cast<int>(g_settings().MTOptions.ShiftMode) + 1;
+    next.ShiftIndicator = getShiftIndicator();
+
+    if (g_playerVehicle != 0) {
+        next.Gear = g_vehData.mGearCurr;
+        next.NextGear = g_vehData.mGearNext;
+        next.TopGear = g_vehData.mGearTop;
+        next.RPM = g_vehData.mRPM;
+        next.Clutch = g_vehData.mClutch;
+        next.Throttle = g_vehData.mThrottle;
+    }
+
+    // Single writer: the script fiber.
+    uint32_t sequence = stateSequence.load(std::memory_order_relaxed);
+    stateSequence.store(sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    std::memcpy(&state, &next, sizeof(state));
+    stateSequence.store(sequence + 2, std::memory_order_release);
+}
+
 const char* MT_GetVersion() {
     return Constants::DisplayVersion;
 }
@@ -32,7 +120,7 @@ void MT_SetActive(bool active) {
 }
 
 bool MT_NeutralGear() {
-    return g_gearStates.FakeNeutral && g_settings.MTOptions.Enable;
+    return readState().NeutralGear;
 }
 
 int MT_GetShiftMode() {
@@ -45,29 +133,7 @@ void MT_SetShiftMode(int mode) {
 }
 
 int MT_GetShiftIndicator() {
-    if (!ENTITY::DOES_ENTITY_EXIST(g_playerVehicle)) {
-        // vehData is not initialized yet, so mGearRatios can not be dereferenced.
-        return 0;
-    }
-    float nextGearMinSpeed = 0.0f; // don't care about top gear
-    if (g_gearStates.LockGear < g_vehData.mGearTop) {
-        nextGearMinSpeed = g_settings().AutoParams.NextGearMinRPM * g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_gearStates.LockGear + 1];
-    }
-    float engineLoad = g_controls.ThrottleVal - map(g_vehData.mRPM, 0.2f, 1.0f, 0.0f, 1.0f);
-    bool shiftUpLoad = g_gearStates.LockGear < g_vehData.mGearTop && 
-        engineLoad < g_settings().AutoParams.UpshiftLoad && 
-        g_vehData.mWheelAverageDrivenTyreSpeed > nextGearMinSpeed;
-
-    float currGearMinSpeed = g_settings().AutoParams.CurrGearMinRPM * g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_gearStates.LockGear];
-    bool shiftDownLoad = engineLoad > g_settings().AutoParams.DownshiftLoad || g_vehData.mWheelAverageDrivenTyreSpeed < currGearMinSpeed;
-
-    if (g_gearStates.HitRPMSpeedLimiter || g_gearStates.HitRPMLimiter || shiftUpLoad) {
-        return 1;
-    }
-    if (g_vehData.mGearCurr > 1 && shiftDownLoad) {
-        return 2;
-    }
-    return 0;
+    return readState().ShiftIndicator;
 }
 
 float MT_GetAutoEcoRate() {
@@ -78,24 +144,54 @@ void MT_SetAutoEcoRate(float rate) {
     g_settings().AutoParams.EcoRate = rate;
 }
 
+// g_ignoredVehicles is kept sorted, so lookups can binary search it.
 void MT_AddIgnoreVehicle(int vehicle) {
-    if (std::find(g_ignoredVehicles.begin(), g_ignoredVehicles.end(), vehicle) == g_ignoredVehicles.end()) {
-        g_ignoredVehicles.push_back(vehicle);
+    std::lock_guard lock(g_ignoredVehiclesMutex);
+    auto it = std::lower_bound(g_ignoredVehicles.begin(), g_ignoredVehicles.end(), vehicle);
+    if (it == g_ignoredVehicles.end() || *it != vehicle) {
+        g_ignoredVehicles.insert(it, vehicle);
     }
 }
 
 void MT_DelIgnoreVehicle(int vehicle) {
-    auto it = std::find(g_ignoredVehicles.begin(), g_ignoredVehicles.end(), vehicle);
-    if (it != g_ignoredVehicles.end()) {
+    std::lock_guard lock(g_ignoredVehiclesMutex);
+    auto it = std::lower_bound(g_ignoredVehicles.begin(), g_ignoredVehicles.end(), vehicle);
+    if (it != g_ignoredVehicles.end() && *it == vehicle) {
         g_ignoredVehicles.erase(it);
     }
 }
 
+void MT_AddIgnoreVehicles(const int* vehicles, unsigned count) {
+    if (vehicles == nullptr || count == 0)
+        return;
+
+    std::lock_guard lock(g_ignoredVehiclesMutex);
+    g_ignoredVehicles.insert(g_ignoredVehicles.end(), vehicles, vehicles + count);
+    std::sort(g_ignoredVehicles.begin(), g_ignoredVehicles.end());
+    g_ignoredVehicles.erase(std::unique(g_ignoredVehicles.begin(), g_ignoredVehicles.end()),
+        g_ignoredVehicles.end());
+}
+
+void MT_DelIgnoreVehicles(const int* vehicles, unsigned count) {
+    if (vehicles == nullptr || count == 0)
+        return;
+
+    std::vector<Vehicle> removed(vehicles, vehicles + count);
+    std::sort(removed.begin(), removed.end());
+    std::lock_guard lock(g_ignoredVehiclesMutex);
+    g_ignoredVehicles.erase(std::remove_if(g_ignoredVehicles.begin(), g_ignoredVehicles.end(),
+        [&removed](Vehicle vehicle) {
+            return std::binary_search(removed.begin(), removed.end(), vehicle);
+        }), g_ignoredVehicles.end());
+}
+
 void MT_ClearIgnoredVehicles() {
+    std::lock_guard lock(g_ignoredVehiclesMutex);
     g_ignoredVehicles.clear();
 }
 
 unsigned MT_NumIgnoredVehicles() {
+    std::lock_guard lock(g_ignoredVehiclesMutex);
     return static_cast<unsigned>(g_ignoredVehicles.size());
 }
 
@@ -103,21 +199,45 @@ const int* MT_GetIgnoredVehicles() {
     return g_ignoredVehicles.data();
 }
 
+unsigned MT_GetIgnoredVehiclesCopy(int* vehicles, unsigned capacity) {
+    if (vehicles == nullptr)
+        capacity = 0;
+
+    std::lock_guard lock(g_ignoredVehiclesMutex);
+    unsigned count = static_cast<unsigned>(g_ignoredVehicles.size());
+    std::copy_n(g_ignoredVehicles.begin(), std::min(count, capacity), vehicles);
+    return count;
+}
+
+unsigned MT_GetNPCGearboxStates(MT_NPCGearboxState* states, unsigned capacity) {
+    if (states == nullptr)
+        capacity = 0;
+    return getNPCGearboxStates(states, capacity);
+}
+
 int MT_GetManagedVehicle() {
-    return g_playerVehicle;
+    return readState().ManagedVehicle;
 }
 
 bool MT_LookingLeft() {
-    return g_controls.ButtonIn(CarControls::WheelControlType::LookLeft);
+    return readState().LookingLeft;
 }
 
 bool MT_LookingRight() {
-    return g_controls.ButtonIn(CarControls::WheelControlType::LookRight);
+    return readState().LookingRight;
 }
 
 bool MT_LookingBack() {
-    return g_controls.ButtonIn(CarControls::WheelControlType::LookBack) ||
+    return readState().LookingBack;
+}
+
+unsigned MT_GetStateSnapshot(MT_StateSnapshot* snapshot, unsigned size) {
+    if (snapshot == nullptr)
+        return 0;
 
-        g_controls.ButtonIn(CarControls::WheelControlType::LookLeft) &&
-        g_controls.ButtonIn(CarControls::WheelControlType::LookRight);
+    MT_StateSnapshot copy = readState();
+    unsigned bytes = std::min(size, static_cast<unsigned>(sizeof(copy)));
+    copy.Size = bytes;
+    std::memcpy(snapshot, &copy, bytes);
+    return bytes;
 }
@@ -90,6 +90,22 @@ MT_API void         MT_AddIgnoreVehicle(int vehicle);
  */
 MT_API void         MT_DelIgnoreVehicle(int vehicle);
 
+/**
+ * \brief           Add vehicles that the AI shifting code should ignore,
+ *                  like calling MT_AddIgnoreVehicle for each.
+ * \param [in] vehicles Vehicles to ignore.
+ * \param [in] count Number of vehicles.
+ */
+MT_API void         MT_AddIgnoreVehicles(const int* vehicles, unsigned count);
+
+/**
+ * \brief           Remove vehicles from AI shift control ignore,
+ *                  like calling MT_DelIgnoreVehicle for each.
+ * \param [in] vehicles Vehicles to stop ignoring.
+ * \param [in] count Number of vehicles.
+ */
+MT_API void         MT_DelIgnoreVehicles(const int* vehicles, unsigned count);
+
 /**
  * \brief           Return all vehicles back to AI shifting control.
  */
@@ -103,10 +119,47 @@ MT_API unsigned     MT_NumIgnoredVehicles();
 
 /**
  * \brief           Get the vehicles that AI shifting ignores.
+ *                  The array is only valid until the ignored vehicles
+ *                  change, so copy it before calling the functions above.
+ *                  Call it from a script thread only: unlike the other
+ *                  ignore functions, reading the array isn't locked.
+ *                  From other threads, use MT_GetIgnoredVehiclesCopy.
  * \return          Array of ignored Vehicles.
  */
 MT_API const int*   MT_GetIgnoredVehicles();
 
+/**
+ * \brief           Copy the vehicles that AI shifting ignores, in handle order.
+ *                  Safe to call from any thread.
+ *                  Pass null and 0 to only get the count.
+ * \param [out] vehicles Array to fill in.
+ * \param [in] capacity Size of vehicles.
+ * \return          Number of ignored vehicles, which may be more than capacity.
+ */
+MT_API unsigned     MT_GetIgnoredVehiclesCopy(int* vehicles, unsigned capacity);
+
+/**
+ * \brief           Gearbox state of a vehicle under AI shifting control.
+ */
+struct MT_NPCGearboxState {
+    int Vehicle;
+    int Gear;                   // Current gear, 0 is reverse
+    int NextGear;               // Gear being shifted into
+    bool Shifting;              // A shift is in progress
+    bool FakeNeutral;
+};
+
+/**
+ * \brief           Get the gearbox states of all vehicles under AI shifting
+ *                  control, as of the last NPC script tick. Ignored vehicles
+ *                  aren't included. Empty while MT isn't active.
+ *                  Pass null and 0 to only get the count.
+ * \param [out] states Array to fill in.
+ * \param [in] capacity Size of states.
+ * \return          Number of managed vehicles, which may be more than capacity.
+ */
+MT_API unsigned     MT_GetNPCGearboxStates(MT_NPCGearboxState* states, unsigned capacity);
+
 /**
  * \brief           Gets the vehicle under control of the script.
  * \return          Handle to the Vehicle entity the player is using.
@@ -134,3 +187,51 @@ MT_API bool MT_LookingRight();
  * \return          True for pressed, false for not.
  */
 MT_API bool MT_LookingBack();
+
+/*
+ * State snapshot
+ */
+
+/**
+ * \brief           Version of MT_StateSnapshot, bumped when fields are added.
+ */
+#define MT_STATE_SNAPSHOT_VERSION 1
+
+/**
+ * \brief           Mod state, published once per script tick.
+ *                  Fields are only ever added at the end, so older callers
+ *                  can keep passing a smaller size.
+ */
+struct MT_StateSnapshot {
+    unsigned Size;              // Bytes filled in by MT_GetStateSnapshot
+    unsigned Version;           // MT_STATE_SNAPSHOT_VERSION of the mod
+    unsigned long long Tick;    // Script tick the state was published on
+
+    int ManagedVehicle;         // MT_GetManagedVehicle
+    bool Active;                // MT_IsActive
+    bool NeutralGear;           // MT_NeutralGear
+    bool Shifting;              // A shift is in progress
+    bool LookingLeft;           // MT_LookingLeft
+    bool LookingRight;          // MT_LookingRight
+    bool LookingBack;           // MT_LookingBack
+    int ShiftMode;              // MT_GetShiftMode
+    int ShiftIndicator;         // MT_GetShiftIndicator
+
+    int Gear;                   // Current gear, 0 is reverse
+    int NextGear;               // Gear being shifted into
+    int TopGear;
+    float RPM;                  // 0.2 (idle) to 1.0 (redline)
+    float Clutch;               // 0.0 (disengaged) to 1.0 (engaged)
+    float Throttle;             // 0.0 to 1.0
+};
+
+/**
+ * \brief           Copy the state published on the last script tick.
+ *                  The copy is consistent: all fields come from one tick.
+ *                  MT_NeutralGear, MT_GetShiftIndicator, MT_GetManagedVehicle
+ *                  and MT_Looking* read the same state.
+ * \param [out] snapshot Snapshot to fill in.
+ * \param [in] size sizeof(MT_StateSnapshot) of the caller.
+ * \return          Bytes copied, 0 when snapshot is null.
+ */
+MT_API unsigned     MT_GetStateSnapshot(MT_StateSnapshot* snapshot, unsigned size);
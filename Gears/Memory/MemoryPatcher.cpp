@@ -2,17 +2,15 @@
 
 #include "Versions.h"
 #include "../Util/Logger.hpp"
+#include "../Util/Timer.h"
 
 #include "PatternInfo.h"
 #include "Patcher.h"
+#include "PatchSet.h"
 
 namespace MemoryPatcher {
-const int NumGearboxPatches = 5;
 int NumGearboxPatched = 0;
 
-const int maxAttempts = 4;
-int gearboxAttempts = 0;
-
 bool Error = false;
 
 // When disabled, shift-up doesn't trigger.
@@ -54,6 +52,50 @@ PatcherJmp SteeringAssistPatcher("Steer: Steering assist", steeringAssist, true)
 PatternInfo steeringControl;
 Patcher SteeringControlPatcher("Steer: Steering input", steeringControl, true);
 
+// MT can't work without any of these.
+PatchSet GearboxPatches("Gears", {
+    &ClutchLowRPMPatcher, &ClutchRevLimPatcher, &ShiftDownPatcher, &ShiftUpPatcher
+});
+
+// Not found in every game version, MT works without them.
+PatchSet OptionalGearboxPatches("Gears (optional)", {
+    &ThrottleLiftPatcher
+});
+
+PatchSet SteeringPatches("Steer", {
+    &SteeringAssistPatcher, &SteeringControlPatcher
+});
+
+namespace {
+    uint32_t wantedPatches = 0;
+
+    // More transitions per second than this is logged as thrashing.
+    const uint32_t maxTransitionsPerSecond = 10;
+    uint32_t transitions = 0;
+    uint32_t lastTransitions = 0;
+    Timer transitionTimer(1000);
+
+    bool gearboxPatched() {
+        return GearboxPatches.Patched() &&
+            (OptionalGearboxPatches.Patched() || OptionalGearboxPatches.Disabled());
+    }
+
+    int numGearboxPatched() {
+        return GearboxPatches.NumPatched() + OptionalGearboxPatches.NumPatched();
+    }
+
+    void reconcile(EPatch patch, bool allApplied, bool anyApplied, bool(*apply)(), bool(*restore)()) {
+        if (Wanted(patch)) {
+            if (!allApplied && apply())
+                ++transitions;
+        }
+        else {
+            if (anyApplied && restore())
+                ++transitions;
+        }
+    }
+}
+
 void SetPatterns(int version) {
     // Valid for 877 to 1290
     shiftUp = PatternInfo("\x66\x89\x13\xB8\x05\x00\x00\x00", "xxxxxxxx", 
@@ -122,87 +164,34 @@ bool Test() {
 }
 
 bool ApplyGearboxPatches() {
-    if (gearboxAttempts > maxAttempts) {
-        return false;
-    }
-
-    logger.Write(DEBUG, "[Patch] [Gears] Patching");
-
-    if (NumGearboxPatches == NumGearboxPatched) {
-        logger.Write(DEBUG, "[Patch] [Gears] Already patched");
-        return true;
-    }
-
-    if (ClutchLowRPMPatcher.Patch()) {
-        NumGearboxPatched++;
-    }
-
-    if (ClutchRevLimPatcher.Patch()) {
-        NumGearboxPatched++;
-    }
-
-    if (ShiftDownPatcher.Patch()) {
-        NumGearboxPatched++;
-    }
-
-    if (ShiftUpPatcher.Patch()) {
-        NumGearboxPatched++;
-    }
-
-    if (ThrottleLiftPatcher.Patch()) {
-        NumGearboxPatched++;
-    }
-
-    if (NumGearboxPatched == NumGearboxPatches) {
-        logger.Write(DEBUG, "[Patch] [Gears] Patch success");
-        gearboxAttempts = 0;
-        return true;
-    }
-    logger.Write(ERROR, "[Patch] [Gears] Patching failed");
-    gearboxAttempts++;
-
-    if (gearboxAttempts > maxAttempts) {
-        logger.Write(ERROR, "[Patch] [Gears] Patch attempt limit exceeded");
-        logger.Write(ERROR, "[Patch] [Gears] Patching disabled");
-    }
-    return false;
+    bool success = GearboxPatches.Patch();
+    // Only logged when missing, the core patches stay applied.
+    if (success && !OptionalGearboxPatches.Disabled())
+        OptionalGearboxPatches.Patch();
+    NumGearboxPatched = numGearboxPatched();
+    return success;
 }
 
 bool RevertGearboxPatches() {
-    logger.Write(DEBUG, "[Patch] [Gears] Restoring instructions");
-
-    if (NumGearboxPatched == 0) {
-        logger.Write(DEBUG, "[Patch] [Gears] Already restored/intact");
-        return true;
-    }
-
-    if (ClutchLowRPMPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
-
-    if (ClutchRevLimPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
-
-    if (ShiftDownPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
+    bool success = GearboxPatches.Restore();
+    success &= OptionalGearboxPatches.Restore();
+    NumGearboxPatched = numGearboxPatched();
+    return success;
+}
 
-    if (ShiftUpPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
+bool VerifyGearboxPatches() {
+    bool intact = GearboxPatches.Verify();
+    intact &= OptionalGearboxPatches.Verify();
+    NumGearboxPatched = numGearboxPatched();
+    return intact;
+}
 
-    if (ThrottleLiftPatcher.Restore()) {
-        NumGearboxPatched--;
-    }
+bool PatchSteering() {
+    return SteeringPatches.Patch();
+}
 
-    if (NumGearboxPatched == 0) {
-        logger.Write(DEBUG, "[Patch] [Gears] Restore success");
-        gearboxAttempts = 0;
-        return true;
-    }
-    logger.Write(ERROR, "[Patch] [Gears] Restore failed");
-    return false;
+bool RestoreSteering() {
+    return SteeringPatches.Restore();
 }
 
 bool PatchSteeringAssist() {
@@ -236,6 +225,62 @@ bool PatchThrottle() {
 bool RestoreThrottle() {
     return ThrottlePatcher.Restore();
 }
+
+void SetWanted(EPatch patch, bool wanted) {
+    if (wanted)
+        wantedPatches |= static_cast<uint32_t>(patch);
+    else
+        wantedPatches &= ~static_cast<uint32_t>(patch);
+}
+
+bool Wanted(EPatch patch) {
+    return (wantedPatches & static_cast<uint32_t>(patch)) != 0;
+}
+
+void ReconcilePatch(EPatch patch) {
+    switch (patch) {
+        case EPatch::Gearbox:
+            // Re-applies patches the game wrote over
+            if (Wanted(EPatch::Gearbox))
+                VerifyGearboxPatches();
+            reconcile(patch, gearboxPatched(), numGearboxPatched() != 0,
+                ApplyGearboxPatches, RevertGearboxPatches);
+            break;
+        case EPatch::Steering:
+            reconcile(patch, SteeringPatches.Patched(), SteeringPatches.NumPatched() != 0,
+                PatchSteering, RestoreSteering);
+            break;
+        case EPatch::Throttle:
+            reconcile(patch, ThrottlePatcher.Patched(), ThrottlePatcher.Patched(),
+                PatchThrottle, RestoreThrottle);
+            break;
+        case EPatch::Brake:
+            reconcile(patch, BrakePatcher.Patched(), BrakePatcher.Patched(),
+                PatchBrake, RestoreBrake);
+            break;
+    }
+}
+
+void ReconcilePatches() {
+    ReconcilePatch(EPatch::Gearbox);
+    ReconcilePatch(EPatch::Steering);
+    ReconcilePatch(EPatch::Throttle);
+    ReconcilePatch(EPatch::Brake);
+
+    if (transitionTimer.Expired()) {
+        lastTransitions = transitions;
+        transitions = 0;
+        transitionTimer.Reset();
+
+        if (lastTransitions > maxTransitionsPerSecond) {
+            logger.Write(WARN, "[Patch] %u patch transitions in the last second", lastTransitions);
+        }
+    }
+}
+
+uint32_t TransitionsPerSecond() {
+    return lastTransitions;
+}
 }
 
 // Steering assist/correction:
@@ -1,5 +1,8 @@
 #pragma once
 #include "Patcher.h"
+#include "PatchSet.h"
+
+#include <cstdint>
 
 namespace MemoryPatcher {
 void SetPatterns(int version);
@@ -7,11 +10,24 @@ bool Test();
 
 /*
  * Patch clutch and gearbox behavior so they can be script-controlled
- * Changes multiple things.
+ * Changes multiple things. Fails when any of the core patches can't be
+ * applied, optional patches that can't be applied are only logged.
  */
 bool ApplyGearboxPatches();
 bool RevertGearboxPatches();
 
+/*
+ * Forget gearbox patches the game wrote over, so they're applied again.
+ * Returns false if any were.
+ */
+bool VerifyGearboxPatches();
+
+/*
+ * Steering assist and steering control together
+ */
+bool PatchSteering();
+bool RestoreSteering();
+
 /*
  * Remove steering correction and steering scaling at speed
  */
@@ -36,13 +52,42 @@ bool RestoreBrake();
 bool PatchThrottle();
 bool RestoreThrottle();
 
+/*
+ * Wanted patch state. Features say which patches they need while they
+ * update, and ReconcilePatches() only applies or restores what changed.
+ */
+enum class EPatch : uint32_t {
+    Gearbox  = 1 << 0,
+    Steering = 1 << 1,
+    Throttle = 1 << 2,
+    Brake    = 1 << 3,
+};
+
+// Kept until changed, takes effect on the next ReconcilePatches().
+void SetWanted(EPatch patch, bool wanted);
+bool Wanted(EPatch patch);
+
+// Applies or restores one patch to match the wanted state, for features
+// that need the change to take effect before the end of the tick.
+void ReconcilePatch(EPatch patch);
+
+// Applies and restores patches to match the wanted state.
+// Call once, at the end of the tick.
+void ReconcilePatches();
+
+// Patches applied or restored by ReconcilePatches() in the last complete second.
+uint32_t TransitionsPerSecond();
+
 extern bool Error;
 
-extern const int NumGearboxPatches;
 extern int NumGearboxPatched;
 
 extern Patcher ThrottlePatcher;
 extern Patcher BrakePatcher;
 extern PatcherJmp SteeringAssistPatcher;
 extern Patcher SteeringControlPatcher;
+
+extern PatchSet GearboxPatches;
+extern PatchSet OptionalGearboxPatches;
+extern PatchSet SteeringPatches;
 }
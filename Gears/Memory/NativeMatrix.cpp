@@ -6,6 +6,11 @@
 #include "NativeMatrix.h"
 #include <cmath>
 
+#if defined(_M_X64) || defined(__SSE__)
+#include <xmmintrin.h>
+#define NATIVE_MATRIX_SSE
+#endif
+
 NativeMatrix4x4 Scaling(Vector3 scale) {
     // identity
     NativeMatrix4x4 result{
@@ -54,8 +59,61 @@ NativeMatrix4x4 RotationAxis(Vector3 axis, float angle) {
     return result;
 }
 
+void RotateAxis(NativeMatrix4x4& matrix, Vector3 axis, float angle) {
+    float x = axis.x;
+    float y = axis.y;
+    float z = axis.z;
+
+    float cos_ = cos(angle);
+    float sin_ = sin(angle);
+    float xx = x * x;
+    float yy = y * y;
+    float zz = z * z;
+    float xy = x * y;
+    float xz = x * z;
+    float yz = y * z;
+
+    const float r[3][3] = {
+        { xx + (cos_ * (1.0f - xx)),          (xy - (cos_ * xy)) + (sin_ * z),    (xz - (cos_ * xz)) - (sin_ * y) },
+        { (xy - (cos_ * xy)) - (sin_ * z),    yy + (cos_ * (1.0f - yy)),          (yz - (cos_ * yz)) + (sin_ * x) },
+        { (xz - (cos_ * xz)) + (sin_ * y),    (yz - (cos_ * yz)) - (sin_ * x),    zz + (cos_ * (1.0f - zz)) },
+    };
+
+    // The 4th row of the rotation is identity, so the 4th row of the matrix stays.
+    float* rows = &matrix.M11;
+    float m[3][4];
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            m[i][j] = rows[i * 4 + j];
+        }
+    }
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 4; ++j) {
+            rows[i * 4 + j] = r[i][0] * m[0][j] + r[i][1] * m[1][j] + r[i][2] * m[2][j];
+        }
+    }
+}
+
 NativeMatrix4x4 Multiply(const NativeMatrix4x4& left, const NativeMatrix4x4& right) {
     NativeMatrix4x4 temp;
+#ifdef NATIVE_MATRIX_SSE
+    // Each result row is the right rows, weighted by the left row.
+    // The struct is packed, so use unaligned loads.
+    const float* l = &left.M11;
+    const float* r = &right.M11;
+    const __m128 r1 = _mm_loadu_ps(r + 0);
+    const __m128 r2 = _mm_loadu_ps(r + 4);
+    const __m128 r3 = _mm_loadu_ps(r + 8);
+    const __m128 r4 = _mm_loadu_ps(r + 12);
+    float* t = &temp.M11;
+    for (int i = 0; i < 4; ++i) {
+        __m128 row = _mm_mul_ps(_mm_set1_ps(l[i * 4 + 0]), r1);
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(l[i * 4 + 1]), r2));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(l[i * 4 + 2]), r3));
+        row = _mm_add_ps(row, _mm_mul_ps(_mm_set1_ps(l[i * 4 + 3]), r4));
+        _mm_storeu_ps(t + i * 4, row);
+    }
+#else
     temp.M11 = (left.M11 * right.M11) + (left.M12 * right.M21) + (left.M13 * right.M31) + (left.M14 * right.M41);
     temp.M12 = (left.M11 * right.M12) + (left.M12 * right.M22) + (left.M13 * right.M32) + (left.M14 * right.M42);
     temp.M13 = (left.M11 * right.M13) + (left.M12 * right.M23) + (left.M13 * right.M33) + (left.M14 * right.M43);
@@ -72,6 +130,7 @@ NativeMatrix4x4 Multiply(const NativeMatrix4x4& left, const NativeMatrix4x4& rig
     temp.M42 = (left.M41 * right.M12) + (left.M42 * right.M22) + (left.M43 * right.M32) + (left.M44 * right.M42);
     temp.M43 = (left.M41 * right.M13) + (left.M42 * right.M23) + (left.M43 * right.M33) + (left.M44 * right.M43);
     temp.M44 = (left.M41 * right.M14) + (left.M42 * right.M24) + (left.M43 * right.M34) + (left.M44 * right.M44);
+#endif
     return temp;
 }
 
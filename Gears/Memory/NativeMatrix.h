@@ -39,4 +39,8 @@ struct NativeMatrix4x4
 NativeMatrix4x4 Scaling(Vector3 scale);
 NativeMatrix4x4 RotationAxis(Vector3 axis, float angle);
 NativeMatrix4x4 Multiply(const NativeMatrix4x4& left, const NativeMatrix4x4& right);
+
+// Same as matrix = RotationAxis(axis, angle) * matrix, but only computes the
+// 3x3 rotation part, as the rest of the rotation matrix is identity.
+void RotateAxis(NativeMatrix4x4& matrix, Vector3 axis, float angle);
 NativeMatrix4x4 operator *(const NativeMatrix4x4& left, const NativeMatrix4x4& right);
@@ -3,6 +3,7 @@
 #include "../Util/Logger.hpp"
 #include <Windows.h>
 #include <Psapi.h>
+#include <algorithm>
 #include <sstream>
 
 #include "inc/main.h"
@@ -141,4 +142,51 @@ uintptr_t FindPattern(const char* pattStr) {
     }
     return 0;
 }
+
+bool WriteCode(const std::vector<CodeWrite>& writes) {
+    if (writes.empty())
+        return true;
+
+    SYSTEM_INFO systemInfo{};
+    GetSystemInfo(&systemInfo);
+    const uintptr_t pageSize = systemInfo.dwPageSize;
+
+    // Page, original protection
+    std::vector<std::pair<uintptr_t, DWORD>> pages;
+    for (const auto& write : writes) {
+        uintptr_t first = write.Address & ~(pageSize - 1);
+        uintptr_t last = (write.Address + write.Size - 1) & ~(pageSize - 1);
+        for (uintptr_t page = first; page <= last; page += pageSize) {
+            auto it = std::find_if(pages.begin(), pages.end(), [page](const auto& entry) {
+                return entry.first == page;
+            });
+            if (it == pages.end())
+                pages.emplace_back(page, 0);
+        }
+    }
+
+    bool success = true;
+    size_t unprotected = 0;
+    for (; unprotected < pages.size(); ++unprotected) {
+        auto& [page, protection] = pages[unprotected];
+        if (!VirtualProtect(reinterpret_cast<void*>(page), pageSize, PAGE_EXECUTE_READWRITE, &protection)) {
+            logger.Write(ERROR, "[Patch] Failed to unprotect 0x%p, error %lu", page, GetLastError());
+            success = false;
+            break;
+        }
+    }
+
+    if (success) {
+        for (const auto& write : writes) {
+            memcpy(reinterpret_cast<void*>(write.Address), write.Data, write.Size);
+        }
+        FlushInstructionCache(GetCurrentProcess(), nullptr, 0);
+    }
+
+    for (size_t i = 0; i < unprotected; ++i) {
+        DWORD unused;
+        VirtualProtect(reinterpret_cast<void*>(pages[i].first), pageSize, pages[i].second, &unused);
+    }
+    return success;
+}
 }
@@ -1,12 +1,23 @@
 #pragma once
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
 namespace mem {
+struct CodeWrite {
+    uintptr_t Address;
+    const uint8_t* Data;
+    size_t Size;
+};
+
 void init();
 uintptr_t FindPattern(const char* pattern, const char* mask); 
 uintptr_t FindPattern(const char* pattStr);
 std::vector<uintptr_t> FindPatterns(const char* pattern, const char* mask);
+
+// Copies all writes into code, making each page writable once for all of them.
+// Writes nothing if a page can't be made writable.
+bool WriteCode(const std::vector<CodeWrite>& writes);
 extern uintptr_t(*GetAddressOfEntity)(int entity);
 extern uintptr_t(*GetModelInfo)(unsigned int modelHash, int* index);
 }
@@ -0,0 +1,109 @@
+#include "PatchSet.h"
+
+#include "../Util/Logger.hpp"
+
+#include <utility>
+
+namespace MemoryPatcher {
+PatchSet::PatchSet(std::string name, std::vector<Patcher*> patchers)
+    : mName(std::move(name))
+    , mPatchers(std::move(patchers)) { }
+
+bool PatchSet::Patch() {
+    if (mAttempts > mMaxAttempts) {
+        return false;
+    }
+
+    logger.Write(DEBUG, "[Patch] [%s] Patching", mName.c_str());
+
+    if (Patched()) {
+        logger.Write(DEBUG, "[Patch] [%s] Already patched", mName.c_str());
+        return true;
+    }
+
+    bool prepared = true;
+    std::vector<Patcher*> pending;
+    std::vector<mem::CodeWrite> writes;
+    for (auto* patcher : mPatchers) {
+        if (patcher->Patched())
+            continue;
+
+        // Check all of them, so every problem gets logged.
+        if (!patcher->prepare()) {
+            prepared = false;
+            continue;
+        }
+        pending.push_back(patcher);
+        writes.push_back(patcher->patchWrite());
+    }
+
+    if (prepared && mem::WriteCode(writes)) {
+        for (auto* patcher : pending) {
+            patcher->onPatched();
+        }
+        logger.Write(DEBUG, "[Patch] [%s] Patch success", mName.c_str());
+        mAttempts = 0;
+        return true;
+    }
+
+    logger.Write(ERROR, "[Patch] [%s] Patching failed", mName.c_str());
+    mAttempts++;
+
+    if (mAttempts > mMaxAttempts) {
+        logger.Write(ERROR, "[Patch] [%s] Patch attempt limit exceeded", mName.c_str());
+        logger.Write(ERROR, "[Patch] [%s] Patching disabled", mName.c_str());
+    }
+    return false;
+}
+
+bool PatchSet::Restore() {
+    logger.Write(DEBUG, "[Patch] [%s] Restoring instructions", mName.c_str());
+
+    if (NumPatched() == 0) {
+        logger.Write(DEBUG, "[Patch] [%s] Already restored/intact", mName.c_str());
+        return true;
+    }
+
+    // Don't write the original code over whatever replaced a patch.
+    Verify();
+
+    std::vector<Patcher*> pending;
+    std::vector<mem::CodeWrite> writes;
+    for (auto* patcher : mPatchers) {
+        if (!patcher->Patched())
+            continue;
+        pending.push_back(patcher);
+        writes.push_back(patcher->restoreWrite());
+    }
+
+    if (!mem::WriteCode(writes)) {
+        logger.Write(ERROR, "[Patch] [%s] Restore failed", mName.c_str());
+        return false;
+    }
+
+    for (auto* patcher : pending) {
+        patcher->onRestored();
+    }
+    mAttempts = 0;
+
+    logger.Write(DEBUG, "[Patch] [%s] Restore success", mName.c_str());
+    return true;
+}
+
+bool PatchSet::Verify() {
+    bool intact = true;
+    for (auto* patcher : mPatchers) {
+        intact &= patcher->Verify();
+    }
+    return intact;
+}
+
+int PatchSet::NumPatched() const {
+    int numPatched = 0;
+    for (const auto* patcher : mPatchers) {
+        if (patcher->Patched())
+            ++numPatched;
+    }
+    return numPatched;
+}
+}
@@ -0,0 +1,40 @@
+#pragma once
+#include "Patcher.h"
+
+#include <string>
+#include <vector>
+
+namespace MemoryPatcher {
+// Patches that are applied and restored together.
+// All code is checked before writing, and if any patch can't be applied,
+// nothing is written. Writes are done in one go, so each code page is
+// made writable once.
+class PatchSet {
+public:
+    PatchSet(std::string name, std::vector<Patcher*> patchers);
+
+    bool Patch();
+
+    // Patches the game wrote over are left alone and only forgotten.
+    bool Restore();
+
+    // Forgets patches that the game wrote over, so Patch() re-applies them.
+    // Only compares the patched bytes, so it's cheap enough to run each tick.
+    // Returns false when any were forgotten.
+    bool Verify();
+
+    int NumPatched() const;
+    int Size() const { return static_cast<int>(mPatchers.size()); }
+    bool Patched() const { return NumPatched() == Size(); }
+
+    // Patching failed too often and isn't tried anymore.
+    bool Disabled() const { return mAttempts > mMaxAttempts; }
+
+private:
+    const std::string mName;
+    const std::vector<Patcher*> mPatchers;
+
+    const int mMaxAttempts = 4;
+    int mAttempts = 0;
+};
+}
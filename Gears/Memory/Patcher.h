@@ -3,12 +3,17 @@
 #include "PatternInfo.h"
 #include "../Util/Logger.hpp"
 #include "../Util/Strings.hpp"
+#include <cstring>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace MemoryPatcher {
+class PatchSet;
+
 // simple NOP patcher
 class Patcher {
+    friend class PatchSet;
 public:
     Patcher(std::string name, PatternInfo& pattern, bool verbose)
         : mName(std::move(name))
@@ -20,12 +25,12 @@ public:
         , mAddress(0)
         , mTemp(0) { }
 
-    Patcher(std::string name, PatternInfo& pattern) 
+    Patcher(std::string name, PatternInfo& pattern)
         : Patcher(std::move(name), pattern, false) { }
 
     virtual ~Patcher() = default;
 
-    virtual bool Patch() {
+    bool Patch() {
         if (mAttempts > mMaxAttempts) {
             return false;
         }
@@ -35,31 +40,16 @@ public:
             return true;
         }
 
-        mTemp = Apply();
-
-        if (mTemp) {
-            mAddress = mTemp;
-            mPatched = true;
-            mAttempts = 0;
-
-            if (mVerbose) {
-                std::string bytes = ByteArrayToString(mPattern.Data.data(), mPattern.Data.size());
-                logger.Write(DEBUG, "[Patch] [%s] Patch success, original code: %s", mName.c_str(), bytes.c_str());
-            }
+        if (prepare() && mem::WriteCode({ patchWrite() })) {
+            onPatched();
             return true;
         }
 
-        logger.Write(ERROR, "[Patch] [%s] Patch failed", mName.c_str());
-        mAttempts++;
-
-        if (mAttempts > mMaxAttempts) {
-            logger.Write(ERROR, "[Patch] [%s] Patch attempt limit exceeded", mName.c_str());
-            logger.Write(ERROR, "[Patch] [%s] Patching disabled", mName.c_str());
-        }
+        onPatchFailed();
         return false;
     }
 
-    virtual bool Restore() {
+    bool Restore() {
         if (mVerbose)
             logger.Write(DEBUG, "[Patch] [%s] Restoring instructions", mName.c_str());
 
@@ -69,15 +59,13 @@ public:
             return true;
         }
 
-        if (mAddress) {
-            memcpy((void*)mAddress, mPattern.Data.data(), mPattern.Data.size());
-            mAddress = 0;
-            mPatched = false;
-            mAttempts = 0;
+        // The game wrote over it, so there's nothing left to restore.
+        if (!Verify()) {
+            return true;
+        }
 
-            if (mVerbose) {
-                logger.Write(DEBUG, "[Patch] [%s] Restore success", mName.c_str());
-            }
+        if (mem::WriteCode({ restoreWrite() })) {
+            onRestored();
             return true;
         }
 
@@ -85,6 +73,24 @@ public:
         return false;
     }
 
+    // Whether the patched code is still in place.
+    bool Intact() const {
+        return mPatched &&
+            memcmp(reinterpret_cast<const void*>(mAddress), mPatch.data(), mPatch.size()) == 0;
+    }
+
+    // Forgets the patch when the game has written over it,
+    // so it isn't restored over the new code, and can be patched again.
+    bool Verify() {
+        if (!mPatched || Intact())
+            return true;
+
+        logger.Write(ERROR, "[Patch] [%s] Code changed since patching", mName.c_str());
+        mAddress = 0;
+        mPatched = false;
+        return false;
+    }
+
     uintptr_t Test() const {
         auto addr = mem::FindPattern(mPattern.Pattern, mPattern.Mask);
         if (addr)
@@ -110,27 +116,96 @@ protected:
     uintptr_t mAddress;
     uintptr_t mTemp;
 
-    virtual uintptr_t Apply() {
-        uintptr_t address;
-        if (mTemp != NULL) {
-            address = mTemp;
+    // Bytes written over the original code. The original code is kept in mPattern.Data.
+    std::vector<uint8_t> mPatch;
+
+    // Patch for the code at address.
+    virtual std::vector<uint8_t> build(uintptr_t address) const {
+        return std::vector<uint8_t>(mPattern.Data.size(), 0x90);
+    }
+
+private:
+    uintptr_t find() {
+        if (mTemp != NULL)
+            return mTemp;
+
+        uintptr_t address = mem::FindPattern(mPattern.Pattern, mPattern.Mask);
+        if (address) {
+            address += mPattern.Offset;
+            logger.Write(DEBUG, "[Patch] [%s] found at 0x%p", mName.c_str(), address);
         }
         else {
-            address = mem::FindPattern(mPattern.Pattern, mPattern.Mask);
-            if (address) {
-                address += mPattern.Offset;
-                logger.Write(DEBUG, "[Patch] [%s] found at 0x%p", mName.c_str(), address);
-            }
-            else {
-                logger.Write(ERROR, "[Patch] [%s] not found", mName.c_str());
-            }
+            logger.Write(ERROR, "[Patch] [%s] not found", mName.c_str());
         }
+        return address;
+    }
 
-        if (address) {
-            memcpy(mPattern.Data.data(), (void*)address, mPattern.Data.size());
-            memset(reinterpret_cast<void *>(address), 0x90, mPattern.Data.size());
+    // Whether the code at address still matches the pattern it was found with.
+    bool matches(uintptr_t address) const {
+        auto code = reinterpret_cast<const char*>(address - mPattern.Offset);
+        for (size_t i = 0; mPattern.Mask[i] != '\0'; ++i) {
+            if (mPattern.Mask[i] != '?' && code[i] != mPattern.Pattern[i])
+                return false;
+        }
+        return true;
+    }
+
+    // Finds and checks the code and builds the patch, without writing anything.
+    bool prepare() {
+        uintptr_t address = find();
+        if (!address)
+            return false;
+
+        if (!matches(address)) {
+            logger.Write(ERROR, "[Patch] [%s] Code at 0x%p doesn't match, not patching", mName.c_str(), address);
+            mTemp = 0;
+            return false;
+        }
+
+        mTemp = address;
+        mPatch = build(address);
+        auto code = reinterpret_cast<const uint8_t*>(address);
+        mPattern.Data.assign(code, code + mPatch.size());
+        return true;
+    }
+
+    mem::CodeWrite patchWrite() const {
+        return { mTemp, mPatch.data(), mPatch.size() };
+    }
+
+    mem::CodeWrite restoreWrite() const {
+        return { mAddress, mPattern.Data.data(), mPattern.Data.size() };
+    }
+
+    void onPatched() {
+        mAddress = mTemp;
+        mPatched = true;
+        mAttempts = 0;
+
+        if (mVerbose) {
+            std::string bytes = ByteArrayToString(mPattern.Data.data(), mPattern.Data.size());
+            logger.Write(DEBUG, "[Patch] [%s] Patch success, original code: %s", mName.c_str(), bytes.c_str());
+        }
+    }
+
+    void onPatchFailed() {
+        logger.Write(ERROR, "[Patch] [%s] Patch failed", mName.c_str());
+        mAttempts++;
+
+        if (mAttempts > mMaxAttempts) {
+            logger.Write(ERROR, "[Patch] [%s] Patch attempt limit exceeded", mName.c_str());
+            logger.Write(ERROR, "[Patch] [%s] Patching disabled", mName.c_str());
+        }
+    }
+
+    void onRestored() {
+        mAddress = 0;
+        mPatched = false;
+        mAttempts = 0;
+
+        if (mVerbose) {
+            logger.Write(DEBUG, "[Patch] [%s] Restore success", mName.c_str());
         }
-        return address;
     }
 };
 
@@ -144,36 +219,12 @@ public:
         : Patcher(name, pattern) {}
 
 protected:
-    uintptr_t Apply() override {
-        uintptr_t address;
-        if (mTemp != NULL) {
-            address = mTemp;
-        }
-        else {
-            address = mem::FindPattern(mPattern.Pattern, mPattern.Mask);
-            if (address) {
-                address += mPattern.Offset;
-                logger.Write(DEBUG, "[Patch] [%s] found at 0x%p", mName.c_str(), address);
-            }
-            else {
-                logger.Write(ERROR, "[Patch] [%s] not found", mName.c_str());
-            }
-        }
-
-        if (address) {
-            uint8_t instrArr[6] =
-            { 0xE9, 0x00, 0x00, 0x00, 0x00, 0x90 };               // make preliminary instruction: JMP to <adrr>
-            uint8_t origSteerInstrDest[4] = { 0x00, 0x00, 0x00, 0x00 };
-
-            memcpy(mPattern.Data.data(), (void*)address, 6); // save whole orig instruction
-            memcpy(origSteerInstrDest, (void*)(address + 2), 4);    // save the address it writes to
-            origSteerInstrDest[0] += 1;                             // Increment first byte by 1
-            memcpy(instrArr + 1, origSteerInstrDest, 4);            // use saved address in new instruction
-            memcpy((void*)address, instrArr, 6);                    // patch with new fixed instruction
-
-            return address;
-        }
-        return 0;
+    // JE <rel32> becomes JMP <rel32 + 1> NOP, as JMP is a byte shorter.
+    std::vector<uint8_t> build(uintptr_t address) const override {
+        std::vector<uint8_t> instr = { 0xE9, 0x00, 0x00, 0x00, 0x00, 0x90 };
+        memcpy(instr.data() + 1, reinterpret_cast<const void*>(address + 2), 4); // the address it jumps to
+        instr[1] += 1;
+        return instr;
     }
 };
 }
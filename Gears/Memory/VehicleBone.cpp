@@ -6,6 +6,9 @@
 #include "VehicleBone.h"
 #include "../Util/MathExt.h"
 #include "VehicleExtensions.hpp"
+#include "../Util/Strings.hpp"
+
+#include <inc/natives.h>
 
 using VExt = VehicleExtensions;
 
@@ -15,10 +18,67 @@ void VehicleBones::RotateAxis(Vehicle vehicle, int index, Vector3 axis, float de
     auto inst = reinterpret_cast<fragInstGta*>(fragInstGtaPtr);
 
     NativeMatrix4x4* matrix = &(inst->CacheEntry->Skeleton->ObjectMatrices[index]);
-    Vector3 scalar{};
-    scalar.x = 1.0f;
-    scalar.y = 1.0f;
-    scalar.z = 1.0f;
-    NativeMatrix4x4 newMatrix = Scaling(scalar) * RotationAxis(axis, deg2rad(degrees)) * (*matrix);
-    *matrix = newMatrix;
+    RotateAxis(*matrix, axis, deg2rad(degrees));
+}
+
+void VehicleBones::Skeleton::SetVehicle(Vehicle vehicle) {
+    mVehicle = vehicle;
+    mAddress = vehicle != 0 ? reinterpret_cast<CVehicle*>(VExt::GetAddress(vehicle)) : nullptr;
+    mCacheEntry = nullptr;
+    mSkeleton = nullptr;
+    mData = nullptr;
+    mBoneIndices.clear();
+    validate();
+}
+
+int VehicleBones::Skeleton::GetBoneIndex(const char* name) {
+    if (!validate() || mBoneIndices.empty())
+        return ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(mVehicle, name);
+
+    auto it = mBoneIndices.find(static_cast<uint32_t>(joaat(name)));
+    if (it == mBoneIndices.end())
+        return -1;
+    return it->second;
+}
+
+NativeMatrix4x4* VehicleBones::Skeleton::GetObjectMatrix(int index) {
+    if (!validate() || index < 0 || index >= mSkeleton->NumBones)
+        return nullptr;
+    return &mSkeleton->ObjectMatrices[index];
+}
+
+void VehicleBones::Skeleton::RotateAxis(int index, Vector3 axis, float degrees) {
+    NativeMatrix4x4* matrix = GetObjectMatrix(index);
+    if (matrix == nullptr)
+        return;
+    ::RotateAxis(*matrix, axis, deg2rad(degrees));
+}
+
+bool VehicleBones::Skeleton::validate() {
+    fragCacheEntry* cacheEntry = nullptr;
+    if (mAddress != nullptr && mAddress->Inst != nullptr)
+        cacheEntry = mAddress->Inst->CacheEntry;
+
+    crSkeleton* skeleton = cacheEntry != nullptr ? cacheEntry->Skeleton : nullptr;
+    if (cacheEntry == mCacheEntry && skeleton == mSkeleton)
+        return mSkeleton != nullptr && mSkeleton->ObjectMatrices != nullptr;
+
+    mCacheEntry = cacheEntry;
+    mSkeleton = skeleton;
+
+    crSkeletonData* data = skeleton != nullptr ? skeleton->Data : nullptr;
+    if (data != mData) {
+        mData = data;
+        mBoneIndices.clear();
+        if (data != nullptr && data->Bones != nullptr) {
+            for (int i = 0; i < data->NumBones; ++i) {
+                if (data->Bones[i].NamePtr == nullptr)
+                    continue;
+                // Bone names aren't unique in every model, keep the first like the native.
+                mBoneIndices.emplace(static_cast<uint32_t>(joaat(data->Bones[i].NamePtr)), i);
+            }
+        }
+    }
+
+    return mSkeleton != nullptr && mSkeleton->ObjectMatrices != nullptr;
 }
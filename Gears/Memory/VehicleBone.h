@@ -10,6 +10,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <unordered_map>
 
 namespace VehicleBones {
 #pragma pack(push, 1)
@@ -98,4 +99,35 @@ struct CVehicle {
 static_assert(offsetof(CVehicle, Inst) == 0x30, "bad alignment");
 
 void RotateAxis(Vehicle vehicle, int index, Vector3 axis, float degrees);
+
+// Keeps the skeleton of one vehicle at hand, so bone lookups and rotations
+// don't walk CVehicle -> fragInstGta -> fragCacheEntry -> crSkeleton each time.
+// The frag cache entry can be swapped out while the vehicle exists, so it's
+// compared on each access, and everything is re-read when it changes.
+class Skeleton {
+public:
+    // 0 forgets the vehicle.
+    void SetVehicle(Vehicle vehicle);
+
+    // Bone index by name, -1 if the vehicle doesn't have it.
+    // Uses the skeleton's bone names, or the native while the skeleton isn't loaded.
+    int GetBoneIndex(const char* name);
+
+    // Object matrix of the bone, nullptr when unavailable.
+    NativeMatrix4x4* GetObjectMatrix(int index);
+
+    void RotateAxis(int index, Vector3 axis, float degrees);
+
+private:
+    bool validate();
+
+    Vehicle mVehicle = 0;
+    CVehicle* mAddress = nullptr;
+    fragCacheEntry* mCacheEntry = nullptr;
+    crSkeleton* mSkeleton = nullptr;
+    crSkeletonData* mData = nullptr;
+
+    // Bone name hash (joaat) to bone index
+    std::unordered_map<uint32_t, int> mBoneIndices;
+};
 }
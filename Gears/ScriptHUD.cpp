@@ -1,7 +1,9 @@
 #include "ScriptHUD.h"
 #include <fmt/format.h>
 #include <inc/natives.h>
+#include <cmath>
 #include <numeric>
+#include <tuple>
 
 #include <menu.h>
 
@@ -10,9 +12,13 @@
 #include "DrivingAssists.h"
 #include "LaunchControl.h"
 #include "Memory/VehicleExtensions.hpp"
+#include "Memory/MemoryPatcher.hpp"
 
 #include "Util/MathExt.h"
 #include "Util/UIUtils.h"
+#include "Util/EntityCache.h"
+#include "Util/CachedText.h"
+#include "Util/RingBuffer.h"
 
 #include "Input/CarControls.hpp"
 #include "VehicleData.hpp"
@@ -46,10 +52,44 @@ void drawLSDInfo();
 void drawMouseSteering();
 
 namespace GForce {
-    std::vector<std::pair<float, float>> CoordTrails;
+    RingBuffer<float, 15> TrailX;
+    RingBuffer<float, 15> TrailY;
     Vector3 PrevWorldVel;
 }
 
+namespace {
+    enum class ESpeedoUnit {
+        None,
+        Kph,
+        Mph,
+        Ms,
+    };
+
+    // Setting the unit was parsed from, so it's only parsed again when changed
+    std::string speedoSetting;
+    ESpeedoUnit speedoUnit = ESpeedoUnit::None;
+
+    // Speed, unit, show unit, font
+    CachedText<std::tuple<int, ESpeedoUnit, bool, int>> speedoText;
+    CachedText<int> gearText;
+    CachedText<int> gForceText[3];
+
+    ESpeedoUnit getSpeedoUnit() {
+        if (g_settings.HUD.Speedo.Speedo != speedoSetting) {
+            speedoSetting = g_settings.HUD.Speedo.Speedo;
+            if (speedoSetting == "kph")
+                speedoUnit = ESpeedoUnit::Kph;
+            else if (speedoSetting == "mph")
+                speedoUnit = ESpeedoUnit::Mph;
+            else if (speedoSetting == "ms")
+                speedoUnit = ESpeedoUnit::Ms;
+            else
+                speedoUnit = ESpeedoUnit::None;
+        }
+        return speedoUnit;
+    }
+}
+
 namespace DashLights {
     int LastAbsTime = 0;
     int LastTcsTime = 0;
@@ -187,8 +227,8 @@ Vector3 GetAccelVector() {
     Vector3 worldVel = ENTITY::GET_ENTITY_VELOCITY(g_playerVehicle);
     Vector3 worldVelDelta = (worldVel - GForce::PrevWorldVel);
 
-    Vector3 fwdVec = ENTITY::GET_ENTITY_FORWARD_VECTOR(g_playerVehicle);
-    Vector3 upVec = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, 0.0f, 0.0f, 1.0f) - ENTITY::GET_ENTITY_COORDS(g_playerVehicle, true);
+    Vector3 fwdVec = EntityCache::GetForwardVector(g_playerVehicle);
+    Vector3 upVec = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, 0.0f, 0.0f, 1.0f) - EntityCache::GetCoords(g_playerVehicle);
     Vector3 rightVec = Cross(fwdVec, upVec);
 
     Vector3 relVelDelta{
@@ -223,18 +263,25 @@ void drawGForces() {
     float GForceY = accel.y / 9.8f;
     float GForceZ = accel.z / 9.8f;
 
-    UI::ShowText(locX + 0.100f, locY - 0.075f, 0.5f, fmt::format("LAT: {:.2f} g", GForceX));
-    UI::ShowText(locX + 0.100f, locY - 0.025f, 0.5f, fmt::format("LON: {:.2f} g", GForceY));
-    UI::ShowText(locX + 0.100f, locY + 0.025f, 0.5f, fmt::format("VERT: {:.2f} g", GForceZ));
+    // Keyed in displayed hundredths
+    int gForceKeys[3] = {
+        static_cast<int>(std::lround(GForceX * 100.0f)),
+        static_cast<int>(std::lround(GForceY * 100.0f)),
+        static_cast<int>(std::lround(GForceZ * 100.0f)),
+    };
+    UI::ShowText(locX + 0.100f, locY - 0.075f, 0.5f, gForceText[0].Get(gForceKeys[0],
+        [&]() { return fmt::format("LAT: {:.2f} g", gForceKeys[0] / 100.0f); }));
+    UI::ShowText(locX + 0.100f, locY - 0.025f, 0.5f, gForceText[1].Get(gForceKeys[1],
+        [&]() { return fmt::format("LON: {:.2f} g", gForceKeys[1] / 100.0f); }));
+    UI::ShowText(locX + 0.100f, locY + 0.025f, 0.5f, gForceText[2].Get(gForceKeys[2],
+        [&]() { return fmt::format("VERT: {:.2f} g", gForceKeys[2] / 100.0f); }));
     
     // 1 div = 1G, entire thing = 2g
     float offX = (szX * 0.5f) * GForceX * 0.5f;
     float offY = (szY * 0.5f) * GForceY * 0.5f;
 
-    CoordTrails.emplace_back(offX, offY);
-    while (CoordTrails.size() > 15) {
-        CoordTrails.erase(CoordTrails.begin());
-    }
+    TrailX.Push(offX);
+    TrailY.Push(offY);
 
     GRAPHICS::DRAW_RECT(locX, locY, szX, szY, 0, 0, 0, 127, 0);
     GRAPHICS::DRAW_RECT(locX, locY, 0.001f, szY, 255, 255, 255, 127, 0);
@@ -246,26 +293,18 @@ void drawGForces() {
     GRAPHICS::DRAW_RECT(locX - 0.25f * szX, locY, 0.001f, szY, 127, 127, 127, 127, 0);
     GRAPHICS::DRAW_RECT(locX, locY - 0.25f * szY, szX, 0.001f, 127, 127, 127, 127, 0);
 
-    std::vector<float> allX;
-    std::vector<float> allY;
-
     int alpha = 0;
-    for (auto it = CoordTrails.begin(); it != CoordTrails.end(); ++it) {
-        auto c = *it;
-        if (std::next(it) == CoordTrails.end()) {
-            GRAPHICS::DRAW_RECT(locX + c.first, locY + c.second, szX * 0.025f, szY * 0.025f, 255, 255, 255, 255, 0);
-            allX.push_back(locX + c.first);
-            allY.push_back(locY + c.second);
+    for (size_t i = 0; i < TrailX.Size(); ++i) {
+        if (i + 1 == TrailX.Size()) {
+            GRAPHICS::DRAW_RECT(locX + TrailX[i], locY + TrailY[i], szX * 0.025f, szY * 0.025f, 255, 255, 255, 255, 0);
         }
         else {
-            GRAPHICS::DRAW_RECT(locX + c.first, locY + c.second, szX * 0.025f, szY * 0.025f, 127, 127, 127, alpha, 0);
-            allX.push_back(locX + c.first);
-            allY.push_back(locY + c.second);
+            GRAPHICS::DRAW_RECT(locX + TrailX[i], locY + TrailY[i], szX * 0.025f, szY * 0.025f, 127, 127, 127, alpha, 0);
         }
-        alpha += 255 / static_cast<int>(CoordTrails.size());
+        alpha += 255 / static_cast<int>(TrailX.Size());
     }
 
-    GRAPHICS::DRAW_RECT(avg(allX), avg(allY), szX * 0.020f, szY * 0.020f, 255, 0, 0, 255, 0);
+    GRAPHICS::DRAW_RECT(locX + TrailX.Mean(), locY + TrailY.Mean(), szX * 0.020f, szY * 0.020f, 255, 0, 0, 255, 0);
 }
 
 void drawRPMIndicator(float x, float y, float width, float height, Util::ColorI fg, Util::ColorI bg, float rpm) {
@@ -367,29 +406,33 @@ void drawRPMIndicator() {
     );
 }
 
-std::string formatSpeedo(std::string units, float speed, bool showUnit, int hudFont) {
-    if (units == "kph") 
+const std::string& formatSpeedo(ESpeedoUnit unit, float speed, bool showUnit, int hudFont) {
+    if (unit == ESpeedoUnit::Kph)
         speed = speed * 3.6f;
 
-    if (units == "mph") 
+    if (unit == ESpeedoUnit::Mph)
         speed = speed / 0.44704f;
 
-    if (hudFont != 2 && units == "kph") 
-        units = "km/h";
+    const int displaySpeed = static_cast<int>(std::lround(speed));
 
-    if (hudFont != 2 && units == "ms") 
-        units = "m/s";
+    return speedoText.Get({ displaySpeed, unit, showUnit, hudFont }, [&]() {
+        std::string str = fmt::format("{:03d}", displaySpeed);
+        if (!showUnit)
+            return str;
 
-    std::string str = fmt::format("{:03.0f}", speed);
+        std::string units = g_settings.HUD.Speedo.Speedo;
+        if (hudFont != 2 && unit == ESpeedoUnit::Kph)
+            units = "km/h";
 
-    if (showUnit) 
-        str = fmt::format("{} {}", str, units);
+        if (hudFont != 2 && unit == ESpeedoUnit::Ms)
+            units = "m/s";
 
-    return str;
+        return fmt::format("{} {}", str, units);
+    });
 }
 
 void drawSpeedoMeter() {
-    float dashms = g_vehData.mHasSpeedo ? VExt::GetDashSpeed(g_playerVehicle) : abs(ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y);
+    float dashms = g_vehData.mHasSpeedo ? VExt::GetDashSpeed(g_playerVehicle) : abs(EntityCache::GetSpeedVector(g_playerVehicle).y);
     const Util::ColorI color {
         g_settings.HUD.Speedo.ColorR,
         g_settings.HUD.Speedo.ColorG,
@@ -397,7 +440,7 @@ void drawSpeedoMeter() {
         255
     };
     UI::ShowText(g_settings.HUD.Speedo.XPos, g_settings.HUD.Speedo.YPos, g_settings.HUD.Speedo.Size,
-        formatSpeedo(g_settings.HUD.Speedo.Speedo, dashms, g_settings.HUD.Speedo.ShowUnit, g_settings.HUD.Font),
+        formatSpeedo(getSpeedoUnit(), dashms, g_settings.HUD.Speedo.ShowUnit, g_settings.HUD.Font),
         g_settings.HUD.Font, color, g_settings.HUD.Outline);
 }
 
@@ -424,23 +467,34 @@ void drawShiftModeIndicator() {
 }
 
 void drawGearIndicator() {
-    std::string gear = std::to_string(VExt::GetGearCurr(g_playerVehicle));
+    const int gearCurr = VExt::GetGearCurr(g_playerVehicle);
+
+    // Gear number, negative for P, N and R
+    int gearKey = gearCurr;
     if (VExt::GetHandbrake(g_playerVehicle)) {
-        gear = "P";
+        gearKey = -1;
     }
     else if (g_gearStates.FakeNeutral && g_settings.MTOptions.Enable) {
-        gear = "N";
+        gearKey = -2;
     }
-    else if (VExt::GetGearCurr(g_playerVehicle) == 0) {
-        gear = "R";
+    else if (gearCurr == 0) {
+        gearKey = -3;
     }
+    const std::string& gear = gearText.Get(gearKey, [gearKey]() {
+        switch (gearKey) {
+            case -1: return std::string("P");
+            case -2: return std::string("N");
+            case -3: return std::string("R");
+            default: return std::to_string(gearKey);
+        }
+    });
     Util::ColorI color {
         g_settings.HUD.Gear.ColorR,
         g_settings.HUD.Gear.ColorG,
         g_settings.HUD.Gear.ColorB,
         255
     };
-    if (VExt::GetGearCurr(g_playerVehicle) == VExt::GetTopGear(g_playerVehicle)) {
+    if (gearCurr == VExt::GetTopGear(g_playerVehicle)) {
         color.R = g_settings.HUD.Gear.TopColorR;
         color.G = g_settings.HUD.Gear.TopColorG;
         color.B = g_settings.HUD.Gear.TopColorB;
@@ -462,9 +516,7 @@ void MTHUD::UpdateHUD() {
         if (g_settings.HUD.ShiftMode.Enable) {
             drawShiftModeIndicator();
         }
-        if (g_settings.HUD.Speedo.Speedo == "kph" ||
-            g_settings.HUD.Speedo.Speedo == "mph" ||
-            g_settings.HUD.Speedo.Speedo == "ms") {
+        if (getSpeedoUnit() != ESpeedoUnit::None) {
             drawSpeedoMeter();
         }
         if (g_settings.HUD.RPMBar.Enable) {
@@ -548,6 +600,8 @@ void drawDebugInfo() {
             UI::ShowText(0.01, 0.650, 0.3, fmt::format("Next optimal up-shifting: {:.2f}%", g_gearStates.Atcu.upshiftingIndex * 100.0f));
             UI::ShowText(0.01, 0.675, 0.3, fmt::format("Next optimal down-shifting: {:.2f}%", g_gearStates.Atcu.downshiftingIndex * 100.0f));
         }
+
+        UI::ShowText(0.01, 0.725, 0.3, fmt::format("Patch transitions/s: {}", MemoryPatcher::TransitionsPerSecond()));
     }
 
     UI::ShowText(0.85, 0.050, 0.4, fmt::format("Throttle:\t{:.3f}", g_controls.ThrottleVal) , 4);
@@ -629,12 +683,12 @@ void drawInputWheelInfo() {
 std::vector<Vector3> GetWheelCoords(Vehicle handle) {
     std::vector<Vector3> worldCoords;
     std::vector<Vector3> positions = VExt::GetWheelOffsets(handle);
-    Vector3 position = ENTITY::GET_ENTITY_COORDS(g_playerVehicle, true);
+    Vector3 position = EntityCache::GetCoords(g_playerVehicle);
     Vector3 rotation = ENTITY::GET_ENTITY_ROTATION(g_playerVehicle, 0);
     rotation.x = deg2rad(rotation.x);
     rotation.y = deg2rad(rotation.y);
     rotation.z = deg2rad(rotation.z);
-    Vector3 direction = ENTITY::GET_ENTITY_FORWARD_VECTOR(g_playerVehicle);
+    Vector3 direction = EntityCache::GetForwardVector(g_playerVehicle);
 
     worldCoords.reserve(positions.size());
     for (Vector3 wheelPos : positions) {
@@ -708,7 +762,7 @@ void drawVehicleWheelInfo() {
 }
 
 void drawLSDInfo() {
-    auto lsdData = DrivingAssists::GetLSD();
+    const auto& lsdData = DrivingAssists::GetAssists().LSD;
     std::string fddcol;
     if (lsdData.FDD > 0.1f) { fddcol = "~r~"; }
     if (lsdData.FDD < -0.1f) { fddcol = "~b~"; }
@@ -20,6 +20,7 @@
 #include "Util/ScriptUtils.h"
 #include "Util/AddonSpawnerCache.h"
 #include "Util/Paths.h"
+#include "Util/NativeProfiler.h"
 
 #include "Memory/MemoryPatcher.hpp"
 #include "Memory/VehicleExtensions.hpp"
@@ -58,6 +59,7 @@ extern CarControls g_controls;
 extern ScriptSettings g_settings;
 
 extern std::vector<VehicleConfig> g_vehConfigs;
+extern uint32_t g_vehConfigsGeneration;
 
 struct SFont {
     int ID;
@@ -103,6 +105,12 @@ namespace {
         "Disabled", "On if missing", "Always on"
     };
 
+    const std::vector<std::string> detailFilterStrings{
+        "Box",
+        "Exponential",
+        "Low-pass",
+    };
+
     const std::vector<std::string> notifyLevelStrings{
         "Debug",
         "Info",
@@ -118,6 +126,34 @@ namespace {
 
     std::vector<std::string> diDevicesInfo{ "Press Enter to refresh." };
 
+    // Detail lines of an option, only rebuilt when the key changes, or when
+    // the option wasn't shown last frame, as its inputs may have changed since.
+    template <typename TKey>
+    struct SCachedLines {
+        TKey Key{};
+        int Frame = -2;
+        std::vector<std::string> Lines;
+
+        template <typename TBuild>
+        const std::vector<std::string>& Get(const TKey& key, TBuild&& build) {
+            const int frame = MISC::GET_FRAME_COUNT();
+            if (!(key == Key) || frame - Frame > 1) {
+                Key = key;
+                Lines = build();
+            }
+            Frame = frame;
+            return Lines;
+        }
+
+        void Invalidate() {
+            Frame = -2;
+        }
+    };
+
+    // Keyed on the reload generation too, so a reloaded config at the same address is rebuilt.
+    SCachedLines<std::pair<const VehicleConfig*, uint32_t>> configOverview;
+    SCachedLines<std::pair<size_t, size_t>> animationInfo;
+
     bool getKbEntry(float& val) {
         UI::Notify(INFO, "Enter value");
         MISC::DISPLAY_ONSCREEN_KEYBOARD(LOCALIZATION::GET_CURRENT_LANGUAGE() == 0, "FMMC_KEY_TIP8", "",
@@ -211,6 +247,7 @@ void saveAllSettings() {
 void onMenuClose() {
     saveAllSettings();
     loadConfigs();
+    syncFileWatchers();
 }
 
 void update_mainmenu() {
@@ -529,13 +566,16 @@ std::vector<std::string> formatVehicleConfig(const VehicleConfig& config) {
     return extras;
 }
 
+const std::vector<std::string>& getVehicleConfigOverview(const VehicleConfig& config) {
+    return configOverview.Get({ &config, g_vehConfigsGeneration },
+        [&config]() { return formatVehicleConfig(config); });
+}
+
 std::string getASCachedModelName(Hash model) {
-    std::unordered_map<Hash, std::string> cache = ASCache::Get();
-    if (!cache.empty()) {
-        auto bla = cache.find(model);
-        if (bla != cache.end())
-            return bla->second;
-    }
+    const auto& cache = ASCache::Get();
+    auto it = cache.find(model);
+    if (it != cache.end())
+        return it->second;
     return {};
 }
 
@@ -614,8 +654,7 @@ void update_vehconfigmenu() {
               "When multiple configurations work with the same model, the configuration that comes first "
               "alphabetically is used." });
         if (sel) {
-            auto extras = formatVehicleConfig(g_settings());
-            g_menu.OptionPlusPlus(extras, "Configuration overview");
+            g_menu.OptionPlusPlus(getVehicleConfigOverview(g_settings()), "Configuration overview");
         }
     }
     else {
@@ -630,8 +669,7 @@ void update_vehconfigmenu() {
         };
         g_menu.OptionPlus(vehConfig.Name, {}, &sel, nullptr, nullptr, "", descr);
         if (sel) {
-            auto extras = formatVehicleConfig(vehConfig);
-            g_menu.OptionPlusPlus(extras, "Configuration overview");
+            g_menu.OptionPlusPlus(getVehicleConfigOverview(vehConfig), "Configuration overview");
         }
     }
 
@@ -1169,6 +1207,12 @@ void update_forcefeedbackmenu() {
         { "Averages the detail effect to prevent force feedback spikes.",
         "Recommended to keep as low as possible, as higher values delay more."});
 
+    g_menu.StringArray("Detail effect filter", detailFilterStrings, g_settings.Wheel.FFB.DetailFilter,
+        { "How the detail effect is averaged.",
+          "Box: Plain average.",
+          "Exponential: Reacts quicker to new bumps, with a longer tail.",
+          "Low-pass: Smoothest, cuts high frequency vibration the most." });
+
     g_menu.FloatOption("Collision effect multiplier", g_settings.Wheel.FFB.CollisionMult, 0.0f, 10.0f, 0.1f,
         { "Force feedback effect caused by frontal/rear collisions." });
 
@@ -2043,37 +2087,55 @@ void update_debugmenu() {
             "Green: Vehicle velocity","Red: Vehicle rotation","Purple: Steering direction" });
     g_menu.BoolOption("Show NPC info", g_settings.Debug.DisplayNPCInfo,
         { "Show vehicle info of NPC vehicles near you." });
+    if (NativeProfiler::Available()) {
+        g_menu.BoolOption("Show native calls", g_settings.Debug.DisplayNativeCalls,
+            { "Count script native calls per frame and show the most called ones.",
+              "Entries show the native hash, the calling subsystem and the call count." });
+    }
+    if (NativeProfiler::Available() && g_settings.Debug.DisplayNativeCalls) {
+        if (g_menu.Option("Dump native calls",
+            { "Write native call totals since enabling to Gears.log." })) {
+            NativeProfiler::Dump();
+            UI::Notify(INFO, "Native calls written to Gears.log");
+        }
+    }
 
     if (SteeringAnimation::FileProblem()) {
         g_menu.Option("Animation file error", NativeMenu::solidRed, 
             { "An error occurred reading the animation file. Check Gears.log for more details." });
     }
     else {
-        std::vector <std::string> extras;
+        const size_t index = SteeringAnimation::GetAnimationIndex();
+        const size_t numAnims = SteeringAnimation::GetAnimations().size();
 
-        extras.emplace_back("Available animation dictionaries:");
+        const auto& extras = animationInfo.Get({ index, numAnims }, [index]() {
+            std::vector <std::string> extras;
 
-        const auto& anims = SteeringAnimation::GetAnimations();
-        const size_t index = SteeringAnimation::GetAnimationIndex();
-        for (size_t i = 0; i < anims.size(); ++i) {
-            const auto& anim = anims[i];
-            std::string mark = "[ ]";
-            if (i == index) {
-                mark = "[*]";
+            extras.emplace_back("Available animation dictionaries:");
+
+            const auto& anims = SteeringAnimation::GetAnimations();
+            for (size_t i = 0; i < anims.size(); ++i) {
+                const auto& anim = anims[i];
+                std::string mark = "[ ]";
+                if (i == index) {
+                    mark = "[*]";
+                }
+                extras.emplace_back(fmt::format("{} {}", mark, anim.Dictionary));
             }
-            extras.emplace_back(fmt::format("{} {}", mark, anim.Dictionary));
-        }
 
-        extras.emplace_back("");
-        extras.emplace_back("* marks active dictionary.");
-        if (index >= SteeringAnimation::GetAnimations().size()) {
-            extras.push_back(fmt::format("Index out of range ({})", index));
-        }
+            extras.emplace_back("");
+            extras.emplace_back("* marks active dictionary.");
+            if (index >= anims.size()) {
+                extras.push_back(fmt::format("Index out of range ({})", index));
+            }
 
-        extras.emplace_back("");
-        extras.emplace_back("Press left/right to change animation manually.");
+            extras.emplace_back("");
+            extras.emplace_back("Press left/right to change animation manually.");
+            return extras;
+        });
 
-        std::function<void()> onLeft = [index, anims]() {
+        std::function<void()> onLeft = [index]() {
+            const auto& anims = SteeringAnimation::GetAnimations();
             if (!anims.empty()) {
                 if (index == 0) {
                     // Set to "none"
@@ -2085,7 +2147,8 @@ void update_debugmenu() {
             }
         };
 
-        std::function<void()> onRight = [index, anims]() {
+        std::function<void()> onRight = [index]() {
+            const auto& anims = SteeringAnimation::GetAnimations();
             if (!anims.empty()) {
                 // allow 1 past, to set to none
                 if (index >= anims.size()) {
@@ -2101,6 +2164,7 @@ void update_debugmenu() {
             nullptr, onRight, onLeft, "Animations", 
             { "Shows current animation override status. Enter to reload." })) {
             SteeringAnimation::Load();
+            animationInfo.Invalidate();
         }
     }
 
@@ -2185,125 +2249,151 @@ void update_perfmenu() {
             "Disabling hampers AI braking." });
 }
 
-void update_menu() {
-    g_menu.CheckKeys();
+namespace {
+    struct SMenuPage {
+        const char* Name;
+        void(*Update)();
+    };
+
+    const std::vector<SMenuPage> menuPages {
+        /* mainmenu */
+        { "mainmenu", update_mainmenu },
+
+        /* mainmenu -> settingsmenu */
+        { "settingsmenu", update_settingsmenu },
+
+        /* mainmenu -> settingsmenu -> featuresmenu */
+        { "featuresmenu", update_featuresmenu },
 
-    /* mainmenu */
-    if (g_menu.CurrentMenu("mainmenu")) { update_mainmenu(); }
+        /* mainmenu -> settingsmenu -> finetuneoptionsmenu */
+        { "finetuneoptionsmenu", update_finetuneoptionsmenu },
 
-    /* mainmenu -> settingsmenu */
-    if (g_menu.CurrentMenu("settingsmenu")) { update_settingsmenu(); }
+        /* mainmenu -> settingsmenu -> shiftingoptionsmenu */
+        { "shiftingoptionsmenu", update_shiftingoptionsmenu },
 
-    /* mainmenu -> settingsmenu -> featuresmenu */
-    if (g_menu.CurrentMenu("featuresmenu")) { update_featuresmenu(); }
+        /* mainmenu -> settingsmenu -> finetuneautooptionsmenu */
+        { "finetuneautooptionsmenu", update_finetuneautooptionsmenu },
 
-    /* mainmenu -> settingsmenu -> finetuneoptionsmenu */
-    if (g_menu.CurrentMenu("finetuneoptionsmenu")) { update_finetuneoptionsmenu(); }
+        /* mainmenu -> vehconfigmenu */
+        { "vehconfigmenu", update_vehconfigmenu },
 
-    /* mainmenu -> settingsmenu -> shiftingoptionsmenu */
-    if (g_menu.CurrentMenu("shiftingoptionsmenu")) { update_shiftingoptionsmenu(); }
+        /* mainmenu -> controlsmenu */
+        { "controlsmenu", update_controlsmenu },
 
-    /* mainmenu -> settingsmenu -> finetuneautooptionsmenu */
-    if (g_menu.CurrentMenu("finetuneautooptionsmenu")) { update_finetuneautooptionsmenu(); }
+        /* mainmenu -> controlsmenu -> controllermenu */
+        { "controllermenu", update_controllermenu },
 
-    /* mainmenu -> vehconfigmenu */
-    if (g_menu.CurrentMenu("vehconfigmenu")) { update_vehconfigmenu(); }
+        /* mainmenu -> controlsmenu -> controllermenu -> controllerbindingsnativemenu */
+        { "controllerbindingsnativemenu", update_controllerbindingsnativemenu },
 
-    /* mainmenu -> controlsmenu */
-    if (g_menu.CurrentMenu("controlsmenu")) { update_controlsmenu(); }
+        /* mainmenu -> controlsmenu -> controllermenu -> controllerbindingsxinputmenu */
+        { "controllerbindingsxinputmenu", update_controllerbindingsxinputmenu },
 
-    /* mainmenu -> controlsmenu -> controllermenu */
-    if (g_menu.CurrentMenu("controllermenu")) { update_controllermenu(); }
+        /* mainmenu -> controlsmenu -> keyboardmenu */
+        { "keyboardmenu", update_keyboardmenu },
 
-    /* mainmenu -> controlsmenu -> controllermenu -> controllerbindingsnativemenu */
-    if (g_menu.CurrentMenu("controllerbindingsnativemenu")) { update_controllerbindingsnativemenu(); }
+        /* mainmenu -> controlsmenu -> steeringassistmenu */
+        { "steeringassistmenu", update_steeringassistmenu },
 
-    /* mainmenu -> controlsmenu -> controllermenu -> controllerbindingsxinputmenu */
-    if (g_menu.CurrentMenu("controllerbindingsxinputmenu")) { update_controllerbindingsxinputmenu(); }
+        /* mainmenu -> controlsmenu -> steeringassistmenu -> mousesteeringoptionsmenu */
+        { "mousesteeringoptionsmenu", update_mousesteeringoptionsmenu },
 
-    /* mainmenu -> controlsmenu -> keyboardmenu */
-    if (g_menu.CurrentMenu("keyboardmenu")) { update_keyboardmenu(); }
+        /* mainmenu -> controlsmenu -> wheelmenu */
+        { "wheelmenu", update_wheelmenu },
 
-    /* mainmenu -> controlsmenu -> steeringassistmenu */
-    if (g_menu.CurrentMenu("steeringassistmenu")) { update_steeringassistmenu(); }
+        /* mainmenu -> controlsmenu -> wheelmenu -> anglemenu */
+        { "anglemenu", update_anglemenu },
 
-    /* mainmenu -> controlsmenu -> steeringassistmenu -> mousesteeringoptionsmenu */
-    if (g_menu.CurrentMenu("mousesteeringoptionsmenu")) { update_mousesteeringoptionsmenu(); }
+        /* mainmenu -> controlsmenu -> wheelmenu -> axesmenu */
+        { "axesmenu", update_axesmenu },
 
-    /* mainmenu -> controlsmenu -> wheelmenu */
-    if (g_menu.CurrentMenu("wheelmenu")) { update_wheelmenu(); }
+        /* mainmenu -> controlsmenu -> wheelmenu -> forcefeedbackmenu */
+        { "forcefeedbackmenu", update_forcefeedbackmenu },
 
-    /* mainmenu -> controlsmenu -> wheelmenu -> anglemenu */
-    if (g_menu.CurrentMenu("anglemenu")) { update_anglemenu(); }
+        /* mainmenu -> controlsmenu -> wheelmenu -> buttonsmenu */
+        { "buttonsmenu", update_buttonsmenu },
 
-    /* mainmenu -> controlsmenu -> wheelmenu -> axesmenu */
-    if (g_menu.CurrentMenu("axesmenu")) { update_axesmenu(); }
+        /* mainmenu -> controlsmenu -> update_controlsvehconfmenu */
+        { "vehiclecontroladjustsmenu", update_controlsvehconfmenu },
 
-    /* mainmenu -> controlsmenu -> wheelmenu -> forcefeedbackmenu */
-    if (g_menu.CurrentMenu("forcefeedbackmenu")) { update_forcefeedbackmenu(); }
+        /* mainmenu -> hudmenu */
+        { "hudmenu", update_hudmenu },
 
-    /* mainmenu -> controlsmenu -> wheelmenu -> buttonsmenu */
-    if (g_menu.CurrentMenu("buttonsmenu")) { update_buttonsmenu(); }
+        /* mainmenu -> hudmenu -> geardisplaymenu */
+        { "geardisplaymenu", update_geardisplaymenu },
 
-    /* mainmenu -> controlsmenu -> update_controlsvehconfmenu */
-    if (g_menu.CurrentMenu("vehiclecontroladjustsmenu")) { update_controlsvehconfmenu(); }
+        /* mainmenu -> hudmenu -> speedodisplaymenu */
+        { "speedodisplaymenu", update_speedodisplaymenu },
 
-    /* mainmenu -> hudmenu */
-    if (g_menu.CurrentMenu("hudmenu")) { update_hudmenu(); }
+        /* mainmenu -> hudmenu -> rpmdisplaymenu */
+        { "rpmdisplaymenu", update_rpmdisplaymenu },
 
-    /* mainmenu -> hudmenu -> geardisplaymenu*/
-    if (g_menu.CurrentMenu("geardisplaymenu")) { update_geardisplaymenu(); }
+        /* mainmenu -> hudmenu -> wheelinfomenu */
+        { "wheelinfomenu", update_wheelinfomenu },
 
-    /* mainmenu -> hudmenu -> speedodisplaymenu*/
-    if (g_menu.CurrentMenu("speedodisplaymenu")) { update_speedodisplaymenu(); }
+        /* mainmenu -> hudmenu -> dashindicatormenu */
+        { "dashindicatormenu", update_dashindicatormenu },
 
-    /* mainmenu -> hudmenu -> rpmdisplaymenu*/
-    if (g_menu.CurrentMenu("rpmdisplaymenu")) { update_rpmdisplaymenu(); }
+        /* mainmenu -> hudmenu -> mousehudmenu */
+        { "mousehudmenu", update_mousehudmenu },
 
-    /* mainmenu -> hudmenu -> wheelinfomenu*/
-    if (g_menu.CurrentMenu("wheelinfomenu")) { update_wheelinfomenu(); }
+        /* mainmenu -> driveassistmenu */
+        { "driveassistmenu", update_driveassistmenu },
 
-    /* mainmenu -> hudmenu -> dashindicatormenu*/
-    if (g_menu.CurrentMenu("dashindicatormenu")) { update_dashindicatormenu(); }
+        /* mainmenu -> driveassistmenu -> espsettingsmenu */
+        { "espsettingsmenu", update_espsettingsmenu },
 
-    /* mainmenu -> hudmenu -> mousehudmenu*/
-    if (g_menu.CurrentMenu("mousehudmenu")) { update_mousehudmenu(); }
+        /* mainmenu -> driveassistmenu -> awdsettingsmenu */
+        { "awdsettingsmenu", update_awdsettingsmenu },
 
-    /* mainmenu -> driveassistmenu */
-    if (g_menu.CurrentMenu("driveassistmenu")) { update_driveassistmenu(); }
+        /* mainmenu -> gameassistmenu */
+        { "gameassistmenu", update_gameassistmenu },
 
-    /* mainmenu -> driveassistmenu -> espsettingsmenu */
-    if (g_menu.CurrentMenu("espsettingsmenu")) { update_espsettingsmenu(); }
+        /* mainmenu -> miscoptionsmenu */
+        { "miscoptionsmenu", update_miscoptionsmenu },
 
-    /* mainmenu -> driveassistmenu -> awdsettingsmenu */
-    if (g_menu.CurrentMenu("awdsettingsmenu")) { update_awdsettingsmenu(); }
+        /* mainmenu -> miscoptionsmenu -> cameraoptionsmenu */
+        { "cameraoptionsmenu", update_cameraoptionsmenu },
 
-    /* mainmenu -> gameassistmenu */
-    if (g_menu.CurrentMenu("gameassistmenu")) { update_gameassistmenu(); }
+        /* mainmenu -> miscoptionsmenu -> cameraoptionsmenu -> bikecameraoptionsmenu */
+        { "bikecameraoptionsmenu", update_bikecameraoptionsmenu },
 
-    /* mainmenu -> miscoptionsmenu */
-    if (g_menu.CurrentMenu("miscoptionsmenu")) { update_miscoptionsmenu(); }
+        /* mainmenu -> miscoptionsmenu -> cameraoptionsmenu -> cameramovementoptionsmenu */
+        { "cameramovementoptionsmenu", update_cameramovementoptionsmenu },
 
-    /* mainmenu -> miscoptionsmenu -> cameraoptionsmenu */
-    if (g_menu.CurrentMenu("cameraoptionsmenu")) { update_cameraoptionsmenu(); }
+        /* mainmenu -> devoptionsmenu */
+        { "devoptionsmenu", update_devoptionsmenu },
 
-    /* mainmenu -> miscoptionsmenu -> cameraoptionsmenu -> bikecameraoptionsmenu*/
-    if (g_menu.CurrentMenu("bikecameraoptionsmenu")) { update_bikecameraoptionsmenu(); }
+        /* mainmenu -> devoptionsmenu -> debugmenu */
+        { "debugmenu", update_debugmenu },
 
-    /* mainmenu -> miscoptionsmenu -> cameraoptionsmenu -> cameramovementoptionsmenu*/
-    if (g_menu.CurrentMenu("cameramovementoptionsmenu")) { update_cameramovementoptionsmenu(); }
+        /* mainmenu -> devoptionsmenu -> metricsmenu */
+        { "metricsmenu", update_metricsmenu },
 
-    /* mainmenu -> devoptionsmenu */
-    if (g_menu.CurrentMenu("devoptionsmenu")) { update_devoptionsmenu(); }
+        /* mainmenu -> devoptionsmenu -> perfmenu */
+        { "perfmenu", update_perfmenu },
+    };
 
-    /* mainmenu -> devoptionsmenu -> debugmenu */
-    if (g_menu.CurrentMenu("debugmenu")) { update_debugmenu(); }
+    // The page open last frame is checked first, so browsing
+    // a page costs a single compare per frame.
+    size_t lastMenuPage = 0;
+}
 
-    /* mainmenu -> devoptionsmenu -> metricsmenu */
-    if (g_menu.CurrentMenu("metricsmenu")) { update_metricsmenu(); }
+void update_menu() {
+    g_menu.CheckKeys();
 
-    /* mainmenu -> devoptionsmenu -> perfmenu */
-    if (g_menu.CurrentMenu("perfmenu")) { update_perfmenu(); }
+    if (g_menu.CurrentMenu(menuPages[lastMenuPage].Name)) {
+        menuPages[lastMenuPage].Update();
+    }
+    else {
+        for (size_t i = 0; i < menuPages.size(); ++i) {
+            if (g_menu.CurrentMenu(menuPages[i].Name)) {
+                lastMenuPage = i;
+                menuPages[i].Update();
+                break;
+            }
+        }
+    }
 
     g_menu.EndMenu();
 }
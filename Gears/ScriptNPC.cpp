@@ -1,4 +1,5 @@
 #include "script.h"
+#include "ManualTransmission.h"
 
 #ifdef _DEBUG
 #include "Dump.h"
@@ -19,6 +20,7 @@
 
 #include <inc/natives.h>
 #include <fmt/format.h>
+#include <mutex>
 #include <set>
 
 using VExt = VehicleExtensions;
@@ -29,11 +31,19 @@ extern ScriptSettings g_settings;
 extern Ped g_playerPed;
 extern Vehicle g_playerVehicle;
 
+// Sorted, changed through the MT_*IgnoreVehicle* exports.
+// API callers may be on other threads, so only touch it under the mutex.
+std::mutex g_ignoredVehiclesMutex;
 std::vector<Vehicle> g_ignoredVehicles;
 std::vector<NPCVehicle> g_npcVehicles;
 
 DWORD   raycastUpdateTime = 0;
 
+// Gearbox states of the vehicles updated in the last NPC tick.
+// Read by API callers, which may be on other threads.
+std::mutex g_npcStatesMutex;
+std::vector<MT_NPCGearboxState> g_npcStates;
+
 class NPCVehicle {
 public:
     NPCVehicle(Vehicle vehicle)
@@ -346,7 +356,25 @@ std::set<Vehicle> updateRaycastVehicles() {
     return uniqueVehicles;
 }
 
+bool isNPCVehicleIgnored(int vehicle) {
+    std::lock_guard lock(g_ignoredVehiclesMutex);
+    return std::binary_search(g_ignoredVehicles.begin(), g_ignoredVehicles.end(), vehicle);
+}
+
+unsigned getNPCGearboxStates(MT_NPCGearboxState* states, unsigned capacity) {
+    std::lock_guard lock(g_npcStatesMutex);
+    unsigned count = static_cast<unsigned>(g_npcStates.size());
+    std::copy_n(g_npcStates.begin(), std::min(count, capacity), states);
+    return count;
+}
+
+void publishNPCStates(std::vector<MT_NPCGearboxState>&& states) {
+    std::lock_guard lock(g_npcStatesMutex);
+    g_npcStates = std::move(states);
+}
+
 void updateNPCVehicles(std::vector<NPCVehicle>& vehicles) {
+    std::vector<MT_NPCGearboxState> states;
     for(auto& vehicle : vehicles) {
         if (!ENTITY::DOES_ENTITY_EXIST(vehicle.GetVehicle()))
             continue;
@@ -354,10 +382,7 @@ void updateNPCVehicles(std::vector<NPCVehicle>& vehicles) {
         if (Util::IsPedOnSeat(vehicle.GetVehicle(), g_playerPed, -1))
             continue;
 
-        bool ignored = std::find_if(g_ignoredVehicles.begin(), g_ignoredVehicles.end(), [&](const auto & ignoredVehicle) {
-            return ignoredVehicle == vehicle.GetVehicle();
-        }) != g_ignoredVehicles.end();
-        if (ignored)
+        if (isNPCVehicleIgnored(vehicle.GetVehicle()))
             continue;
 
         updateNPCVehicle(vehicle);
@@ -365,7 +390,17 @@ void updateNPCVehicles(std::vector<NPCVehicle>& vehicles) {
         updateShifting(vehicle.GetVehicle(), vehicle.GetGearbox());
         VExt::SetGearCurr(vehicle.GetVehicle(), vehicle.GetGearbox().LockGear);
         VExt::SetGearNext(vehicle.GetVehicle(), vehicle.GetGearbox().LockGear);
+
+        const auto& gearbox = vehicle.GetGearbox();
+        states.push_back(MT_NPCGearboxState{
+            vehicle.GetVehicle(),
+            gearbox.LockGear,
+            gearbox.NextGear,
+            gearbox.Shifting,
+            gearbox.FakeNeutral,
+        });
     }
+    publishNPCStates(std::move(states));
 }
 
 void updateNPCVehicleList(const std::vector<Vehicle>& newVehicles, std::vector<NPCVehicle>& manVehicles) {
@@ -394,6 +429,9 @@ void updateNPCVehicleList(const std::vector<Vehicle>& newVehicles, std::vector<N
 void update_npc() {
     // I only patch brakes for ABS/TCS/ESP when other stuff is also patched
     bool mtActive = MemoryPatcher::NumGearboxPatched > 0;
+    if (!mtActive)
+        publishNPCStates({});
+
     if (!g_settings.Debug.DisplayNPCInfo && !mtActive) 
         return;
 
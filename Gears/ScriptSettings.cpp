@@ -11,6 +11,7 @@
 #include <simpleini/SimpleIni.h>
 #include <fmt/format.h>
 
+#include <algorithm>
 #include <string>
 
 // TODO: Settings shouldn't *do* anything, other stuff just needs to take stuff from this.
@@ -22,8 +23,6 @@
     }
 
 namespace {
-    VehicleConfig* activeConfig = nullptr;
-
     // Returns a tidied-up version of the configuration tag, if no name is provided.
     std::string formatInputName(const char* cfgTag, const char* name) {
         std::string nameFmt;
@@ -49,13 +48,6 @@ void ScriptSettings::SetVehicleConfig(VehicleConfig* cfg) {
     activeConfig = cfg;
 }
 
-VehicleConfig& ScriptSettings::operator()() {
-    if (activeConfig) {
-        return *activeConfig;
-    }
-    return baseConfig;
-}
-
 bool ScriptSettings::ConfigActive() {
     return activeConfig != nullptr;
 }
@@ -80,6 +72,22 @@ void ScriptSettings::Read(CarControls* scriptControl) {
     parseSettingsControls(scriptControl);
     parseSettingsWheel(scriptControl);
     baseConfig.LoadSettings();
+    scriptControl->CompileBindings();
+}
+
+void ScriptSettings::ReadGeneral() {
+    parseSettingsGeneral();
+    baseConfig.LoadSettings();
+}
+
+void ScriptSettings::ReadControls(CarControls* scriptControl) {
+    parseSettingsControls(scriptControl);
+    scriptControl->CompileBindings();
+}
+
+void ScriptSettings::ReadWheel(CarControls* scriptControl) {
+    parseSettingsWheel(scriptControl);
+    scriptControl->CompileBindings();
 }
 
 void ScriptSettings::SaveGeneral() {
@@ -254,6 +262,8 @@ void ScriptSettings::SaveGeneral() {
     ini.SetBoolValue("DEBUG", "DisplayFFBInfo", Debug.DisplayFFBInfo);
     ini.SetBoolValue("DEBUG", "DisplayGearingInfo", Debug.DisplayGearingInfo);
     ini.SetBoolValue("DEBUG", "DisplayNPCInfo", Debug.DisplayNPCInfo);
+    ini.SetBoolValue("DEBUG", "DisplayNativeCalls", Debug.DisplayNativeCalls);
+    ini.SetBoolValue("DEBUG", "CacheVehicleConfigs", Debug.CacheVehicleConfigs);
     ini.SetBoolValue("DEBUG", "DisableInputDetect", Debug.DisableInputDetect);
     ini.SetBoolValue("DEBUG", "DisablePlayerHide", Debug.DisablePlayerHide);
 
@@ -331,6 +341,7 @@ void ScriptSettings::SaveWheel() const {
     ini.SetDoubleValue("FORCE_FEEDBACK", "DetailMult", Wheel.FFB.DetailMult);
     ini.SetLongValue("FORCE_FEEDBACK", "DetailLim", Wheel.FFB.DetailLim);
     ini.SetLongValue("FORCE_FEEDBACK", "DetailMaw", Wheel.FFB.DetailMAW);
+    ini.SetLongValue("FORCE_FEEDBACK", "DetailFilter", Wheel.FFB.DetailFilter);
     ini.SetLongValue("FORCE_FEEDBACK", "DamperMax", Wheel.FFB.DamperMax);
     ini.SetLongValue("FORCE_FEEDBACK", "DamperMin", Wheel.FFB.DamperMin);
     ini.SetDoubleValue("FORCE_FEEDBACK", "DamperMinSpeed", Wheel.FFB.DamperMinSpeed);
@@ -532,6 +543,8 @@ void ScriptSettings::parseSettingsGeneral() {
     Debug.DisplayGearingInfo = ini.GetBoolValue("DEBUG", "DisplayGearingInfo", Debug.DisplayGearingInfo);
     Debug.DisplayFFBInfo = ini.GetBoolValue("DEBUG", "DisplayFFBInfo", Debug.DisplayFFBInfo);
     Debug.DisplayNPCInfo = ini.GetBoolValue("DEBUG", "DisplayNPCInfo", Debug.DisplayNPCInfo);
+    Debug.DisplayNativeCalls = ini.GetBoolValue("DEBUG", "DisplayNativeCalls", Debug.DisplayNativeCalls);
+    Debug.CacheVehicleConfigs = ini.GetBoolValue("DEBUG", "CacheVehicleConfigs", Debug.CacheVehicleConfigs);
     Debug.DisableInputDetect = ini.GetBoolValue("DEBUG", "DisableInputDetect", Debug.DisableInputDetect);
     Debug.DisablePlayerHide = ini.GetBoolValue("DEBUG", "DisablePlayerHide", Debug.DisablePlayerHide);
 
@@ -712,6 +725,7 @@ void ScriptSettings::parseSettingsWheel(CarControls *scriptControl) {
     Wheel.FFB.DetailMult = ini.GetDoubleValue("FORCE_FEEDBACK", "DetailMult", Wheel.FFB.DetailMult);
     Wheel.FFB.DetailLim = ini.GetLongValue("FORCE_FEEDBACK", "DetailLim", Wheel.FFB.DetailLim);
     Wheel.FFB.DetailMAW = ini.GetLongValue("FORCE_FEEDBACK", "DetailMaw", Wheel.FFB.DetailMAW);
+    Wheel.FFB.DetailFilter = std::clamp(static_cast<int>(ini.GetLongValue("FORCE_FEEDBACK", "DetailFilter", Wheel.FFB.DetailFilter)), 0, 2);
     Wheel.FFB.CollisionMult = ini.GetDoubleValue("FORCE_FEEDBACK", "CollisionMult", Wheel.FFB.CollisionMult);
     Wheel.FFB.Gamma = ini.GetDoubleValue("FORCE_FEEDBACK", "Gamma", Wheel.FFB.Gamma);
     Wheel.FFB.MaxSpeed = ini.GetDoubleValue("FORCE_FEEDBACK", "MaxSpeed", Wheel.FFB.MaxSpeed);
@@ -13,12 +13,20 @@ public:
     ScriptSettings();
     void SetFiles(const std::string &general, const std::string& controls, const std::string &wheel);
     void Read(CarControls* scriptControl);
+    // Reads one of the files again, for when only that file changed.
+    // settings_general.ini also holds the base vehicle config.
+    void ReadGeneral();
+    void ReadControls(CarControls* scriptControl);
+    void ReadWheel(CarControls* scriptControl);
     void SaveGeneral();
     void SaveController(CarControls* scriptControl) const;
     void SaveWheel() const;
 
     void SetVehicleConfig(VehicleConfig* cfg);
-    VehicleConfig& operator()();
+    // Active vehicle config, or the base config. Inline, as it's read all over each tick.
+    VehicleConfig& operator()() {
+        return activeConfig ? *activeConfig : baseConfig;
+    }
     bool ConfigActive();
     VehicleConfig* BaseConfig();
 
@@ -269,6 +277,9 @@ public:
         bool DisplayWheelInfo = false;
         bool DisplayFFBInfo = false;
         bool DisplayNPCInfo = false;
+        bool DisplayNativeCalls = false;
+        // Store parsed vehicle configs, so unchanged files aren't parsed on startup
+        bool CacheVehicleConfigs = true;
         bool DisableInputDetect = false;
         bool DisablePlayerHide = false;
 
@@ -318,6 +329,7 @@ public:
             float DetailMult = 4.0f;
             int DetailLim = 5000;
             int DetailMAW = 3;
+            int DetailFilter = 0; // WheelFilter::EShape
             float CollisionMult = 2.5f;
             float Gamma = 0.8f;
             float MaxSpeed = 80.0f;
@@ -403,4 +415,5 @@ private:
     std::string settingsWheelFile;
     std::string settingsMenuFile;
     VehicleConfig baseConfig;
+    VehicleConfig* activeConfig = nullptr;
 };
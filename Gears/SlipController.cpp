@@ -0,0 +1,113 @@
+#include "SlipController.h"
+
+#include <algorithm>
+#include <cmath>
+
+SlipController::SlipController(const SParams& params)
+    : mParams(params)
+    , mStep(params.StepSize, params.MaxFrameTime) {
+}
+
+void SlipController::SetParams(const SParams& params) {
+    mParams = params;
+    mStep = FixedStep(params.StepSize, params.MaxFrameTime);
+}
+
+void SlipController::Reset() {
+    mWheels.fill(SWheel{});
+    mActive.fill(0);
+    mNumWheels = 0;
+    mStep.Reset();
+}
+
+uint32_t SlipController::Update(float frameTime, float vehicleSpeed,
+    const float* wheelSpeeds, const uint8_t* active, uint8_t numWheels) {
+    mNumWheels = std::min(numWheels, MaxWheels);
+
+    // Slip is only sampled once per frame, the fixed steps advance the
+    // pressure ramps, up to MaxSampleAge, and the hold timers.
+    // The slip ratio keeps its sign when both speeds are negative,
+    // so only the speed check needs the magnitude for braking in reverse.
+    for (uint8_t i = 0; i < mNumWheels; ++i) {
+        bool wheelActive = active[i] != 0 && std::abs(vehicleSpeed) > mParams.MinSpeed;
+        mActive[i] = wheelActive;
+        mWheels[i].RampTime = 0.0f;
+
+        if (!wheelActive) {
+            mWheels[i].Phase = EPhase::Apply;
+            mWheels[i].Pressure = 1.0f;
+            mWheels[i].Slip = 0.0f;
+            mWheels[i].HoldTime = 0.0f;
+            continue;
+        }
+
+        float slip = (vehicleSpeed - wheelSpeeds[i]) / vehicleSpeed;
+        mWheels[i].Slip = std::clamp(slip, 0.0f, 1.0f);
+    }
+
+    uint32_t steps = mStep.Advance(frameTime);
+    for (uint32_t i = 0; i < steps; ++i) {
+        step(mNumWheels);
+    }
+    return steps;
+}
+
+bool SlipController::Modulating() const {
+    for (uint8_t i = 0; i < mNumWheels; ++i) {
+        if (mActive[i] && (mWheels[i].Phase != EPhase::Apply || mWheels[i].Pressure < 1.0f))
+            return true;
+    }
+    return false;
+}
+
+void SlipController::step(uint8_t numWheels) {
+    const float dt = mParams.StepSize;
+
+    for (uint8_t i = 0; i < numWheels; ++i) {
+        if (!mActive[i])
+            continue;
+
+        SWheel& wheel = mWheels[i];
+        const EPhase phase = wheel.Phase;
+        // Out of ramp time on this sample, only the phase and timers update.
+        // Compares the middle of the step, so float error doesn't add or drop one.
+        const bool ramp = wheel.RampTime + 0.5f * dt < mParams.MaxSampleAge;
+
+        switch (wheel.Phase) {
+            case EPhase::Apply:
+                if (wheel.Slip > mParams.ReleaseSlip) {
+                    wheel.Phase = EPhase::Release;
+                    ++wheel.Cycles;
+                    break;
+                }
+                if (ramp)
+                    wheel.Pressure = std::min(wheel.Pressure + mParams.ApplyRate * dt, 1.0f);
+                break;
+            case EPhase::Release:
+                if (wheel.Slip < mParams.HoldSlip) {
+                    wheel.Phase = EPhase::Hold;
+                    wheel.HoldTime = 0.0f;
+                    break;
+                }
+                if (ramp)
+                    wheel.Pressure = std::max(wheel.Pressure - mParams.ReleaseRate * dt, mParams.MinPressure);
+                break;
+            case EPhase::Hold:
+                wheel.HoldTime += dt;
+                if (wheel.Slip > mParams.ReleaseSlip) {
+                    wheel.Phase = EPhase::Release;
+                    ++wheel.Cycles;
+                }
+                else if (wheel.Slip < mParams.ApplySlip || wheel.HoldTime > mParams.MaxHoldTime) {
+                    wheel.Phase = EPhase::Apply;
+                }
+                break;
+        }
+
+        // A new phase gets its own ramp time.
+        if (wheel.Phase != phase)
+            wheel.RampTime = 0.0f;
+        else if (phase != EPhase::Hold)
+            wheel.RampTime += dt;
+    }
+}
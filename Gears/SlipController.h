@@ -0,0 +1,95 @@
+#pragma once
+#include "Util/FixedStep.h"
+
+#include <array>
+#include <cstdint>
+
+// Per-wheel brake slip controller, used by ABS.
+// Runs on its own fixed step, so ramp rates and hold times are in seconds.
+// It doesn't make the behavior independent of frame rate: slip is sampled
+// once per frame and the game reacts to the pressure once per frame, so
+// low frame rates add latency. To limit how far one stale sample drives
+// the pressure, a phase only ramps for MaxSampleAge per sample.
+// Bench/SlipControllerBench.cpp measures the remaining difference, at
+// 30 FPS stops are about 6% longer and the cycle is slower than at 144 FPS.
+// Doesn't touch the game, so it can be driven with synthetic wheel speeds.
+class SlipController {
+public:
+    static constexpr uint8_t MaxWheels = 10;
+
+    enum class EPhase : uint8_t {
+        Apply,
+        Hold,
+        Release,
+    };
+
+    struct SParams {
+        // Internal step size, s
+        float StepSize = 1.0f / 240.0f;
+        // Longest frame that's simulated, longer frames are clamped, s
+        float MaxFrameTime = 0.1f;
+        // Longest a phase ramps the pressure on one slip sample, s
+        // Longer frames keep the pressure for the rest of the frame.
+        float MaxSampleAge = 1.0f / 120.0f;
+
+        // Slip ratio where pressure is released
+        float ReleaseSlip = 0.20f;
+        // Slip ratio where released pressure is held again
+        float HoldSlip = 0.12f;
+        // Slip ratio where held pressure is re-applied
+        float ApplySlip = 0.08f;
+        // Longest hold before re-applying anyway, s
+        float MaxHoldTime = 0.05f;
+
+        // Pressure multiplier change rates, 1/s
+        float ApplyRate = 8.0f;
+        float ReleaseRate = 20.0f;
+        // Lowest pressure multiplier while released
+        float MinPressure = 0.0f;
+
+        // Below this vehicle speed the controller is inactive, m/s
+        float MinSpeed = 3.0f;
+    };
+
+    struct SWheel {
+        EPhase Phase = EPhase::Apply;
+        // Brake pressure multiplier, 0.0 to 1.0
+        float Pressure = 1.0f;
+        float Slip = 0.0f;
+        float HoldTime = 0.0f;
+        // Ramp time on the current sample, s
+        float RampTime = 0.0f;
+        // Number of release phases entered, for diagnostics
+        uint32_t Cycles = 0;
+    };
+
+    SlipController() = default;
+    explicit SlipController(const SParams& params);
+
+    void SetParams(const SParams& params);
+    const SParams& Params() const { return mParams; }
+
+    void Reset();
+
+    // frameTime:    Elapsed time since the last update, s
+    // vehicleSpeed: Longitudinal speed, m/s, negative in reverse
+    // wheelSpeeds:  Linear tyre speeds, m/s, same sign convention
+    // active:       Wheels that are braked and on the ground
+    // Returns the number of fixed steps taken.
+    uint32_t Update(float frameTime, float vehicleSpeed,
+        const float* wheelSpeeds, const uint8_t* active, uint8_t numWheels);
+
+    const SWheel& Wheel(uint8_t index) const { return mWheels[index]; }
+
+    // Whether any wheel is currently modulated.
+    bool Modulating() const;
+
+private:
+    void step(uint8_t numWheels);
+
+    SParams mParams;
+    std::array<SWheel, MaxWheels> mWheels{};
+    std::array<uint8_t, MaxWheels> mActive{};
+    uint8_t mNumWheels = 0;
+    FixedStep mStep{ mParams.StepSize, mParams.MaxFrameTime };
+};
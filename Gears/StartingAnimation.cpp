@@ -2,9 +2,8 @@
 #include "SteeringAnim.h"
 #include "Memory/VehicleExtensions.hpp"
 #include "Util/ScriptUtils.h"
-#include "Util/Timer.h"
+#include "Util/AnimStreaming.h"
 
-#include <inc/main.h>
 #include <inc/natives.h>
 
 #include <fmt/format.h>
@@ -15,6 +14,10 @@ extern Ped g_playerPed;
 namespace {
     uint8_t lastEngineState = 0;
     bool forcePlay = false;
+    // Engine is starting, but the dictionary is still streaming
+    bool pending = false;
+    // Played from PlayManual, so it doesn't depend on the engine starting
+    bool pendingForced = false;
     SteeringAnimation::Animation currentAnim;
 }
 
@@ -26,39 +29,46 @@ void StartingAnimation::Update() {
         if (engineState == 2 && lastEngineState != engineState || 
             forcePlay) {
             //showText(0.5f, 0.5f, 0.5f, "Starting");
+            pendingForced = forcePlay;
+            forcePlay = false;
 
             auto steeringAnimIdx = SteeringAnimation::GetAnimationIndex();
-            auto steeringAnimations = SteeringAnimation::GetAnimations();
+            const auto& steeringAnimations = SteeringAnimation::GetAnimations();
 
-            if (steeringAnimIdx >= steeringAnimations.size())
-                return;
+            if (steeringAnimIdx < steeringAnimations.size()) {
+                currentAnim = steeringAnimations[steeringAnimIdx];
+                pending = !currentAnim.Dictionary.empty() && !currentAnim.Name.empty();
+            }
+        }
 
-            currentAnim = steeringAnimations[steeringAnimIdx];
-            if (currentAnim.Dictionary.empty() || currentAnim.Name.empty())
-                return;
+        lastEngineState = engineState;
 
-            Timer t(500);
+        // Streaming can take a while, don't start the animation after the engine did.
+        if (pending && !pendingForced && engineState != 2) {
+            pending = false;
+        }
 
-            if (STREAMING::DOES_ANIM_DICT_EXIST(currentAnim.Dictionary.c_str())) {
-                STREAMING::REQUEST_ANIM_DICT(currentAnim.Dictionary.c_str());
-                while (!STREAMING::HAS_ANIM_DICT_LOADED(currentAnim.Dictionary.c_str())) {
-                    if (t.Expired()) {
-                        currentAnim.Dictionary = std::string();
-                        currentAnim.Name = std::string();
-                        forcePlay = false;
-                        return;
-                    }
-                    WAIT(0);
+        if (pending) {
+            switch (AnimStreaming::Request(currentAnim.Dictionary)) {
+                case AnimStreaming::EState::Loading:
+                    break;
+                case AnimStreaming::EState::Loaded: {
+                    currentAnim.Name = "start_engine";
+                    constexpr int flag = 32;
+                    TASK::TASK_PLAY_ANIM(g_playerPed, currentAnim.Dictionary.c_str(), "start_engine", -8.0f, 8.0f, -1, flag, 0.2f, 0, 0, 0);
+                    pending = false;
+                    //UI::Notify(INFO, "Starting");
+                    break;
                 }
-                currentAnim.Name = "start_engine";
-                constexpr int flag = 32;
-                TASK::TASK_PLAY_ANIM(g_playerPed, currentAnim.Dictionary.c_str(), "start_engine", -8.0f, 8.0f, -1, flag, 0.2f, 0, 0, 0);
-                forcePlay = false;
-                //UI::Notify(INFO, "Starting");
+                case AnimStreaming::EState::Failed:
+                    currentAnim = SteeringAnimation::Animation();
+                    pending = false;
+                    break;
             }
         }
-
-        lastEngineState = engineState;
+    }
+    else {
+        pending = false;
     }
 }
 
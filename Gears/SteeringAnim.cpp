@@ -8,10 +8,11 @@
 
 #include "Util/Logger.hpp"
 #include "Util/MathExt.h"
-#include "Util/Timer.h"
 #include "Util/Files.h"
 #include "Util/UIUtils.h"
 #include "Util/ScriptUtils.h"
+#include "Util/Strings.hpp"
+#include "Util/AnimStreaming.h"
 
 #include <inc/natives.h>
 #include <fmt/format.h>
@@ -21,6 +22,7 @@
 #include <string>
 #include <algorithm>
 #include <filesystem>
+#include <unordered_map>
 
 extern Vehicle g_playerVehicle;
 extern Ped g_playerPed;
@@ -44,6 +46,8 @@ namespace {
     };
 
     std::vector<SteeringAnimation::Animation> steeringAnimations;
+    // Layout hash to index in steeringAnimations
+    std::unordered_map<uint32_t, size_t> layoutIndex;
     SteeringAnimation::Animation lastAnimation;
     size_t steeringAnimIdx = 0;
     float setAngle = 0.0f;
@@ -79,6 +83,13 @@ const std::vector<SteeringAnimation::Animation>& SteeringAnimation::GetAnimation
     return steeringAnimations;
 }
 
+size_t SteeringAnimation::FindAnimation(uint32_t layoutHash) {
+    auto it = layoutIndex.find(layoutHash);
+    if (it == layoutIndex.end())
+        return steeringAnimations.size();
+    return it->second;
+}
+
 size_t SteeringAnimation::GetAnimationIndex() {
     return steeringAnimIdx;
 }
@@ -86,6 +97,12 @@ size_t SteeringAnimation::GetAnimationIndex() {
 void SteeringAnimation::SetAnimationIndex(size_t index) {
     cancelAnim(lastAnimation);
     steeringAnimIdx = index;
+
+    // Start streaming now, so the animation is ready by the time it's needed.
+    if (steeringAnimIdx < steeringAnimations.size() &&
+        !steeringAnimations[steeringAnimIdx].Dictionary.empty()) {
+        AnimStreaming::Request(steeringAnimations[steeringAnimIdx].Dictionary);
+    }
 }
 
 void SteeringAnimation::SetRotation(float wheelDegrees) {
@@ -141,6 +158,16 @@ void SteeringAnimation::Load() {
 
         steeringAnimations.clear();
         steeringAnimations = animRoot["Animations"].as<std::vector<Animation>>();
+
+        // First animation listing a layout wins
+        layoutIndex.clear();
+        for (size_t i = 0; i < steeringAnimations.size(); ++i) {
+            for (const std::string& layout : steeringAnimations[i].Layouts) {
+                layoutIndex.emplace(static_cast<uint32_t>(joaat(layout.c_str())), i);
+            }
+        }
+        AnimStreaming::Clear();
+
         logger.Write(DEBUG, fmt::format("Animation: Loaded {} animations", steeringAnimations.size()));
         fileProblem = false;
     }
@@ -186,27 +213,9 @@ void playAnimTime(const SteeringAnimation::Animation& anim, float time) {
     if (!playing) {
         cancelAnim(lastAnimation);
 
-        Timer t(500);
-
-        if (!STREAMING::DOES_ANIM_DICT_EXIST(dict)) {
-            UI::Notify(ERROR, fmt::format("Animation: dictionary does not exist [{}]", dict), false);
-            logger.Write(ERROR, fmt::format("Animation: dictionary does not exist [{}]", dict));
-            // Clear dict so we don't keep loading it
-            steeringAnimations[steeringAnimIdx].Dictionary = std::string();
+        // Not loaded yet, or failed to load
+        if (AnimStreaming::Request(anim.Dictionary) != AnimStreaming::EState::Loaded)
             return;
-        }
-
-        STREAMING::REQUEST_ANIM_DICT(dict);
-        while (!STREAMING::HAS_ANIM_DICT_LOADED(dict)) {
-            if (t.Expired()) {
-                UI::Notify(ERROR, fmt::format("Failed to load animation dictionary [{}]", dict), false);
-                logger.Write(ERROR, fmt::format("Animation: Failed to load dictionary [{}]", dict));
-                // Clear dict so we don't keep loading it
-                steeringAnimations[steeringAnimIdx].Dictionary = std::string();
-                return;
-            }
-            WAIT(0);
-        }
 
         constexpr int flag = ANIM_FLAG_ENABLE_PLAYER_CONTROL;
         TASK::TASK_PLAY_ANIM(g_playerPed, dict, name, -8.0f, 8.0f, -1, flag, 1.0f, 0, 0, 0);
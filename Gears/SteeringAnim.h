@@ -1,4 +1,5 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <vector>
 
@@ -13,6 +14,9 @@ namespace SteeringAnimation {
     void Load();
 
     const std::vector<Animation>& GetAnimations();
+
+    // Index of the first animation for the vehicle layout, GetAnimations().size() if none.
+    size_t FindAnimation(uint32_t layoutHash);
     size_t GetAnimationIndex();
     void SetAnimationIndex(size_t index);
     void SetRotation(float wheelDegrees);
@@ -1,5 +1,6 @@
 #include "UDPTelemetry.h"
 #include "TelemetryPacket.h"
+#include "../Util/EntityCache.h"
 
 #include <inc/natives.h>
 
@@ -13,7 +14,7 @@ void UDPTelemetry::UpdatePacket(Socket& socket, Vehicle vehicle, const VehicleDa
 
     packet.Time = static_cast<float>(MISC::GET_GAME_TIMER()) / 1000.0f;
 
-    auto worldPos = ENTITY::GET_ENTITY_COORDS(vehicle, true);
+    auto worldPos = EntityCache::GetCoords(vehicle);
     auto worldSpeed = ENTITY::GET_ENTITY_VELOCITY(vehicle);
     auto relRotation = ENTITY::GET_ENTITY_ROTATION(vehicle, 0);
     packet.X = worldPos.x;
@@ -5,11 +5,14 @@
 
 namespace {
     std::unordered_map<Hash, std::string> hashCache;
+    // Also set when there's no cache file, so it's only looked for once.
+    bool loaded = false;
 }
 
-std::unordered_map<Hash, std::string> ASCache::Get() {
-    if (!hashCache.empty())
+const std::unordered_map<Hash, std::string>& ASCache::Get() {
+    if (loaded)
         return hashCache;
+    loaded = true;
 
     std::string cacheFile = Paths::GetModuleFolder(Paths::GetOurModuleHandle()) + "\\AddonSpawner\\hashes.cache";
     std::ifstream infile(cacheFile);
@@ -4,5 +4,6 @@
 #include <unordered_map>
 
 namespace ASCache {
-    std::unordered_map<Hash, std::string> Get();
+    // Model hash to model name, read from Add-on Spawner's cache on first use.
+    const std::unordered_map<Hash, std::string>& Get();
 }
\ No newline at end of file
@@ -0,0 +1,67 @@
+#include "AnimStreaming.h"
+
+#include "Logger.hpp"
+#include "Timer.h"
+#include "UIUtils.h"
+
+#include <inc/natives.h>
+#include <fmt/format.h>
+
+#include <unordered_map>
+
+namespace {
+    struct SEntry {
+        AnimStreaming::EState State = AnimStreaming::EState::Loading;
+        Timer Timeout{ 2000 };
+    };
+
+    std::unordered_map<std::string, SEntry> entries;
+
+    void fail(SEntry& entry, const std::string& message) {
+        UI::Notify(ERROR, message, false);
+        logger.Write(ERROR, message);
+        entry.State = AnimStreaming::EState::Failed;
+    }
+}
+
+AnimStreaming::EState AnimStreaming::Request(const std::string& dictionary) {
+    const char* dict = dictionary.c_str();
+
+    auto [it, inserted] = entries.try_emplace(dictionary);
+    SEntry& entry = it->second;
+
+    if (inserted) {
+        if (!STREAMING::DOES_ANIM_DICT_EXIST(dict)) {
+            fail(entry, fmt::format("Animation: Dictionary does not exist [{}]", dictionary));
+            return entry.State;
+        }
+        STREAMING::REQUEST_ANIM_DICT(dict);
+        entry.Timeout.Reset();
+    }
+
+    switch (entry.State) {
+        case EState::Loaded:
+            // The game may have streamed it out again since.
+            if (STREAMING::HAS_ANIM_DICT_LOADED(dict))
+                break;
+            STREAMING::REQUEST_ANIM_DICT(dict);
+            entry.State = EState::Loading;
+            entry.Timeout.Reset();
+            [[fallthrough]];
+        case EState::Loading:
+            if (STREAMING::HAS_ANIM_DICT_LOADED(dict)) {
+                entry.State = EState::Loaded;
+            }
+            else if (entry.Timeout.Expired()) {
+                fail(entry, fmt::format("Animation: Failed to load dictionary [{}]", dictionary));
+            }
+            break;
+        case EState::Failed:
+            break;
+    }
+    return entry.State;
+}
+
+void AnimStreaming::Clear() {
+    entries.clear();
+}
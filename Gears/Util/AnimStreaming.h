@@ -0,0 +1,18 @@
+#pragma once
+#include <string>
+
+// Loads animation dictionaries without blocking the script thread.
+// Request() starts or polls a load and returns its state, so callers
+// can keep asking each frame and start the animation once it's loaded.
+namespace AnimStreaming {
+    enum class EState {
+        Loading,
+        Loaded,
+        Failed, // Doesn't exist or timed out, stays failed until Clear()
+    };
+
+    EState Request(const std::string& dictionary);
+
+    // Forgets all dictionaries, including failed ones.
+    void Clear();
+}
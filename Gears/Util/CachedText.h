@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+
+// Formatted text that's only formatted again when the value it shows changes.
+// Key it on what's displayed, like a rounded value, so it isn't re-formatted
+// for changes that don't show.
+template <typename TKey>
+class CachedText {
+public:
+    template <typename TFormat>
+    const std::string& Get(const TKey& key, TFormat&& format) {
+        if (!mValid || !(key == mKey)) {
+            mKey = key;
+            mText = format();
+            mValid = true;
+        }
+        return mText;
+    }
+
+private:
+    TKey mKey{};
+    std::string mText;
+    bool mValid = false;
+};
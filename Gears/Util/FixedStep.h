@@ -0,0 +1,47 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+
+// Splits variable frame times into fixed steps, so logic that integrates
+// over time behaves the same at any frame rate.
+// Time that doesn't fill a whole step carries over to the next frame.
+class FixedStep {
+public:
+    // stepSize:     Internal step size, s
+    // maxFrameTime: Longest frame that's simulated, longer frames are clamped, s
+    explicit FixedStep(float stepSize = 1.0f / 240.0f, float maxFrameTime = 0.1f)
+        : mStepSize(stepSize)
+        , mMaxFrameTime(maxFrameTime) {
+    }
+
+    // Adds the frame time and returns the number of steps to run for it.
+    uint32_t Advance(float frameTime) {
+        mAccumulator += std::clamp(frameTime, 0.0f, mMaxFrameTime);
+
+        mSteps = 0;
+        while (mAccumulator >= mStepSize) {
+            mAccumulator -= mStepSize;
+            ++mSteps;
+        }
+        return mSteps;
+    }
+
+    void Reset() {
+        mAccumulator = 0.0f;
+        mSteps = 0;
+    }
+
+    float StepSize() const { return mStepSize; }
+
+    // Steps to run for the last Advance().
+    uint32_t Steps() const { return mSteps; }
+
+    // Time covered by the steps of the last Advance(), s
+    float StepTime() const { return static_cast<float>(mSteps) * mStepSize; }
+
+private:
+    float mStepSize;
+    float mMaxFrameTime;
+    float mAccumulator = 0.0f;
+    uint32_t mSteps = 0;
+};
@@ -162,10 +162,10 @@ T GetAngleBetween(T h1, T h2, T separation) {
 
 template <typename Vector3T>
 auto GetAngleBetween(Vector3T a, Vector3T b) {
-    Vector3T normal{};
-    normal.z = static_cast < decltype(a.x) >(1.0);
-    auto angle = acos(Dot(a, b) / (Length(a) * Length(b)));
-    if (Dot(normal, Cross(a, b)) < 0.0)
+    // |a||b| in one sqrt
+    auto angle = acos(Dot(a, b) / std::sqrt(Dot(a, a) * Dot(b, b)));
+    // Sign from the Z of a x b, which is the up normal's dot with it
+    if (a.x * b.y - a.y * b.x < 0.0)
         angle = -angle;
     return angle;
 }
@@ -0,0 +1,163 @@
+#include "NativeProfiler.h"
+
+#include "Logger.hpp"
+#include "UIUtils.h"
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    struct SKey {
+        uint64_t Hash;
+        const char* Scope;
+
+        bool operator==(const SKey& other) const {
+            return Hash == other.Hash && Scope == other.Scope;
+        }
+    };
+
+    struct SKeyHasher {
+        size_t operator()(const SKey& key) const {
+            // Scope names are literals, so the pointer identifies them.
+            return std::hash<uint64_t>()(key.Hash) ^
+                (std::hash<const void*>()(key.Scope) << 1);
+        }
+    };
+
+    struct SStats {
+        uint32_t Frame = 0;     // Calls in the frame being counted
+        uint32_t LastFrame = 0; // Calls in the last complete frame
+        uint32_t MaxFrame = 0;
+        uint64_t Total = 0;
+    };
+
+    bool enabled = false;
+    const char* currentScope = "Other";
+
+    uint64_t frames = 0;
+    uint32_t frameCalls = 0;
+    uint32_t lastFrameCalls = 0;
+
+    std::unordered_map<SKey, SStats, SKeyHasher> stats;
+
+    std::vector<std::pair<SKey, SStats>> sorted(bool lastFrame) {
+        std::vector<std::pair<SKey, SStats>> entries(stats.begin(), stats.end());
+        std::sort(entries.begin(), entries.end(), [lastFrame](const auto& a, const auto& b) {
+            if (lastFrame)
+                return a.second.LastFrame > b.second.LastFrame;
+            return a.second.Total > b.second.Total;
+        });
+        return entries;
+    }
+}
+
+void NativeProfilerCount(uint64_t hash) {
+    if (!enabled)
+        return;
+
+    auto& entry = stats[SKey{ hash, currentScope }];
+    ++entry.Frame;
+    ++entry.Total;
+    ++frameCalls;
+}
+
+NativeProfiler::Scope::Scope(const char* name)
+    : mPrevious(currentScope) {
+    currentScope = name;
+}
+
+NativeProfiler::Scope::~Scope() {
+    currentScope = mPrevious;
+}
+
+bool NativeProfiler::Available() {
+#ifdef NATIVE_PROFILER
+    return true;
+#else
+    return false;
+#endif
+}
+
+void NativeProfiler::SetEnabled(bool enable) {
+    enable &= Available();
+    if (enable && !enabled) {
+        Reset();
+    }
+    enabled = enable;
+}
+
+bool NativeProfiler::Enabled() {
+    return enabled;
+}
+
+void NativeProfiler::NewFrame() {
+    if (!enabled)
+        return;
+
+    for (auto& [key, entry] : stats) {
+        entry.LastFrame = entry.Frame;
+        entry.MaxFrame = std::max(entry.MaxFrame, entry.Frame);
+        entry.Frame = 0;
+    }
+    lastFrameCalls = frameCalls;
+    frameCalls = 0;
+    ++frames;
+}
+
+void NativeProfiler::DrawOverlay() {
+    if (!enabled)
+        return;
+
+    // Don't count the overlay itself.
+    bool wasEnabled = enabled;
+    enabled = false;
+
+    const size_t maxLines = 20;
+    const float x = 0.70f;
+    const float y = 0.05f;
+    const float lineHeight = 0.020f;
+
+    UI::ShowText(x, y, 0.3f, fmt::format("Native calls: {}", lastFrameCalls));
+
+    auto entries = sorted(true);
+    for (size_t i = 0; i < entries.size() && i < maxLines; ++i) {
+        const auto& [key, entry] = entries[i];
+        if (entry.LastFrame == 0)
+            break;
+        UI::ShowText(x, y + lineHeight * static_cast<float>(i + 1), 0.3f,
+            fmt::format("0x{:016X} {}: {} (max {})", key.Hash, key.Scope, entry.LastFrame, entry.MaxFrame));
+    }
+
+    enabled = wasEnabled;
+}
+
+void NativeProfiler::Dump() {
+    if (frames == 0) {
+        logger.Write(INFO, "[Natives] No frames profiled");
+        return;
+    }
+
+    uint64_t total = 0;
+    for (const auto& [key, entry] : stats) {
+        total += entry.Total;
+    }
+
+    logger.Write(INFO, "[Natives] %llu calls over %llu frames, %.1f per frame",
+        total, frames, static_cast<double>(total) / static_cast<double>(frames));
+
+    for (const auto& [key, entry] : sorted(false)) {
+        logger.Write(INFO, fmt::format("[Natives] 0x{:016X} {:<12} total {:>8} avg {:>6.2f} max {:>4}",
+            key.Hash, key.Scope, entry.Total,
+            static_cast<double>(entry.Total) / static_cast<double>(frames), entry.MaxFrame));
+    }
+}
+
+void NativeProfiler::Reset() {
+    stats.clear();
+    frames = 0;
+    frameCalls = 0;
+    lastFrameCalls = 0;
+}
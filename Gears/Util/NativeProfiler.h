@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+
+// Counts native invocations per hash per frame, attributed to the
+// subsystem that was active when the call was made.
+// The counting hook lives in nativeCaller.h and is compiled in with NATIVE_PROFILER,
+// which only Debug builds define, so Release builds don't pay for it.
+namespace NativeProfiler {
+    // Attributes native calls made during its lifetime to a subsystem.
+    // name must outlive the profiler, so use string literals.
+    class Scope {
+    public:
+        explicit Scope(const char* name);
+        ~Scope();
+        Scope(const Scope&) = delete;
+        Scope& operator=(const Scope&) = delete;
+    private:
+        const char* mPrevious;
+    };
+
+    // Whether this build counts native calls at all.
+    bool Available();
+
+    void SetEnabled(bool enabled);
+    bool Enabled();
+
+    // Closes the counts of the previous frame. Call at the start of each script tick.
+    void NewFrame();
+
+    // Draws the busiest natives of the last complete frame.
+    void DrawOverlay();
+
+    // Writes totals since enabling to the log, sorted by call count.
+    void Dump();
+
+    void Reset();
+}
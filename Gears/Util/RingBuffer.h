@@ -0,0 +1,76 @@
+#pragma once
+#include <array>
+#include <cstddef>
+
+// Fixed-capacity history that keeps a running sum of its values,
+// so pushing and averaging don't depend on the size.
+// When full, pushing drops the oldest value.
+template <typename T, size_t N>
+class RingBuffer {
+public:
+    static constexpr size_t Capacity = N;
+
+    void Push(const T& value) {
+        if (mSize == N) {
+            mSum -= mData[mHead];
+            mData[mHead] = value;
+            mHead = (mHead + 1) % N;
+        }
+        else {
+            mData[(mHead + mSize) % N] = value;
+            ++mSize;
+        }
+        mSum += value;
+
+        // Re-sum now and then, so rounding errors don't pile up.
+        if (++mPushes == N) {
+            mPushes = 0;
+            resum();
+        }
+    }
+
+    // Drops the oldest values until at most count are left.
+    void Trim(size_t count) {
+        while (mSize > count) {
+            mSum -= mData[mHead];
+            mHead = (mHead + 1) % N;
+            --mSize;
+        }
+    }
+
+    void Clear() {
+        mHead = 0;
+        mSize = 0;
+        mSum = T{};
+        mPushes = 0;
+    }
+
+    size_t Size() const { return mSize; }
+    bool Empty() const { return mSize == 0; }
+
+    // 0 is the oldest value.
+    const T& operator[](size_t index) const { return mData[(mHead + index) % N]; }
+    const T& Back() const { return (*this)[mSize - 1]; }
+
+    T Sum() const { return mSum; }
+
+    T Mean() const {
+        if (mSize == 0)
+            return T{};
+        return mSum / static_cast<T>(mSize);
+    }
+
+private:
+    void resum() {
+        mSum = T{};
+        for (size_t i = 0; i < mSize; ++i) {
+            mSum += (*this)[i];
+        }
+    }
+
+    std::array<T, N> mData{};
+    size_t mHead = 0; // Index of the oldest value
+    size_t mSize = 0;
+    T mSum{};
+    size_t mPushes = 0;
+};
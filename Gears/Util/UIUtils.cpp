@@ -57,8 +57,8 @@ void UI::ShowText(float x, float y, float scale, const std::string &text,
     HUD::SET_TEXT_FONT(font);
     HUD::SET_TEXT_SCALE(scale, scale);
     HUD::SET_TEXT_COLOUR(rgba.R, rgba.G, rgba.B, rgba.A);
-    HUD::SET_TEXT_WRAP(0.0, 1.0);
-    HUD::SET_TEXT_CENTRE(0);
+    // Text state resets after each draw, and the full-width wrap and
+    // left alignment are the defaults, so they're not set here.
     if (outline) HUD::SET_TEXT_OUTLINE();
     HUD::BEGIN_TEXT_COMMAND_DISPLAY_TEXT("STRING");
     HUD::ADD_TEXT_COMPONENT_SUBSTRING_PLAYER_NAME(text.c_str());
@@ -0,0 +1,85 @@
+#include "WheelFilter.h"
+
+#include <algorithm>
+#include <cmath>
+
+void WheelFilter::Configure(EShape shape, int window) {
+    const size_t newWindow = static_cast<size_t>(std::clamp(window, 1, static_cast<int>(MaxWindow)));
+    if (shape == mShape && newWindow == mWindow)
+        return;
+
+    mShape = shape;
+    mWindow = newWindow;
+
+    // Same mean delay as a box of this length.
+    mAlpha = 2.0f / (static_cast<float>(mWindow) + 1.0f);
+
+    // A box of length N has its -3 dB point at about 0.443 / N cycles per sample.
+    const float cutoff = std::min(0.443f / static_cast<float>(mWindow), 0.45f);
+    const float w0 = 2.0f * static_cast<float>(M_PI) * cutoff;
+    const float cosW0 = std::cos(w0);
+    const float alpha = std::sin(w0) / (2.0f * static_cast<float>(M_SQRT1_2));
+    const float a0 = 1.0f + alpha;
+
+    mBiquad.B0 = (1.0f - cosW0) / 2.0f / a0;
+    mBiquad.B1 = (1.0f - cosW0) / a0;
+    mBiquad.B2 = mBiquad.B0;
+    mBiquad.A1 = -2.0f * cosW0 / a0;
+    mBiquad.A2 = (1.0f - alpha) / a0;
+
+    Reset();
+}
+
+void WheelFilter::Reset() {
+    for (auto& box : mBox) {
+        box.Clear();
+    }
+    mExp.fill(0.0f);
+    mBiquadStates.fill(SBiquadState{});
+    mPrimed = false;
+}
+
+void WheelFilter::Update(std::vector<float>& values) {
+    const size_t numWheels = std::min(values.size(), MaxWheels);
+
+    if (mWindow <= 1) {
+        return;
+    }
+
+    for (size_t i = 0; i < numWheels; ++i) {
+        values[i] = updateWheel(i, values[i]);
+    }
+    mPrimed = true;
+}
+
+float WheelFilter::updateWheel(size_t wheel, float value) {
+    switch (mShape) {
+        case EShape::Box: {
+            // Averages over what's there, so it doesn't ramp up from 0.
+            auto& box = mBox[wheel];
+            box.Trim(mWindow - 1);
+            box.Push(value);
+            return box.Mean();
+        }
+        case EShape::Exponential: {
+            float& state = mExp[wheel];
+            state = mPrimed ? state + mAlpha * (value - state) : value;
+            return state;
+        }
+        case EShape::Biquad: {
+            const SBiquad& c = mBiquad;
+            SBiquadState& s = mBiquadStates[wheel];
+            if (!mPrimed) {
+                // Settled on the first sample.
+                s.Z2 = (c.B2 - c.A2) * value;
+                s.Z1 = (c.B1 - c.A1) * value + s.Z2;
+            }
+            // Transposed direct form II
+            const float out = c.B0 * value + s.Z1;
+            s.Z1 = c.B1 * value - c.A1 * out + s.Z2;
+            s.Z2 = c.B2 * value - c.A2 * out;
+            return out;
+        }
+    }
+    return value;
+}
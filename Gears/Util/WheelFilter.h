@@ -0,0 +1,58 @@
+#pragma once
+#include "RingBuffer.h"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+// Per-wheel low-pass filter for values sampled once per frame.
+// All shapes take the same window, in samples, as their length:
+// - Box:         Average of the last window samples
+// - Exponential: Exponential moving average with the same mean delay as the box
+// - Biquad:      2nd order Butterworth low-pass, cutoff matched to the box
+class WheelFilter {
+public:
+    enum class EShape {
+        Box,
+        Exponential,
+        Biquad,
+    };
+
+    static constexpr size_t MaxWheels = 10;
+    static constexpr size_t MaxWindow = 100;
+
+    // Resets the filter if the shape or window changed.
+    void Configure(EShape shape, int window);
+
+    void Reset();
+
+    // Filters the values in place, one per wheel.
+    void Update(std::vector<float>& values);
+
+private:
+    struct SBiquad {
+        float B0 = 1.0f, B1 = 0.0f, B2 = 0.0f;
+        float A1 = 0.0f, A2 = 0.0f;
+    };
+
+    struct SBiquadState {
+        float Z1 = 0.0f;
+        float Z2 = 0.0f;
+    };
+
+    float updateWheel(size_t wheel, float value);
+
+    EShape mShape = EShape::Box;
+    size_t mWindow = 1;
+
+    // Set once the filter has seen a sample, the first sample primes the state.
+    bool mPrimed = false;
+
+    std::array<RingBuffer<float, MaxWindow>, MaxWheels> mBox;
+
+    float mAlpha = 1.0f;
+    std::array<float, MaxWheels> mExp{};
+
+    SBiquad mBiquad;
+    std::array<SBiquadState, MaxWheels> mBiquadStates{};
+};
@@ -10,17 +10,20 @@ enum EShiftMode : int {
 
 EShiftMode Next(EShiftMode mode);
 
+// Changes made through the reference (e.g. by menu options) are found by comparing
+// against the initial value in Changed(), so reads stay free of side effects.
 template <typename T>
 class Tracked {
     T mValue;
     T mInitialValue;
+    // Set by explicit assignment, even of the same value.
     bool mChanged = false;
 public:
     Tracked(T val) : mValue(val), mInitialValue(val), mChanged(false) { }
     Tracked& operator=(T v) { mChanged = true; mValue = v; return *this; }
  
     operator T() const { return mValue; }
-    operator T&() { if (mValue != mInitialValue) { mChanged = true; } return mValue; }
+    operator T&() { return mValue; }
 
     bool operator==(const T& rhs) { return mValue == rhs; }
     bool operator!=(const T& rhs) { return !(mValue == rhs); }
@@ -0,0 +1,43 @@
+#include "VehicleConfigIndex.h"
+
+#include "Util/Strings.hpp"
+
+void VehicleConfigIndex::Build(const std::vector<VehicleConfig>& configs) {
+    Clear();
+
+    // emplace keeps the first entry, so earlier configs win like a linear search would.
+    for (size_t i = 0; i < configs.size(); ++i) {
+        const auto& config = configs[i];
+        for (const auto& modelName : config.ModelNames) {
+            const uint32_t modelHash = joaat(modelName.c_str());
+            mModels.emplace(modelHash, i);
+
+            for (const auto& plate : config.Plates) {
+                mPlates.emplace(SPlateKey{ modelHash, NormalizePlate(plate) }, i);
+            }
+        }
+    }
+}
+
+void VehicleConfigIndex::Clear() {
+    mModels.clear();
+    mPlates.clear();
+}
+
+size_t VehicleConfigIndex::Find(uint32_t modelHash, const std::string& plate) const {
+    if (!mPlates.empty()) {
+        auto plateIt = mPlates.find(SPlateKey{ modelHash, NormalizePlate(plate) });
+        if (plateIt != mPlates.end())
+            return plateIt->second;
+    }
+
+    auto modelIt = mModels.find(modelHash);
+    if (modelIt != mModels.end())
+        return modelIt->second;
+
+    return NotFound;
+}
+
+std::string VehicleConfigIndex::NormalizePlate(const std::string& plate) {
+    return StrUtil::toLower(plate);
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include "VehicleConfig.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Lookup tables from model hash and plate to a loaded vehicle config.
+// Holds indices into the config list it was built from, so rebuild it
+// whenever that list changes.
+class VehicleConfigIndex {
+public:
+    static constexpr size_t NotFound = static_cast<size_t>(-1);
+
+    void Build(const std::vector<VehicleConfig>& configs);
+    void Clear();
+
+    // Index of the first config matching both model and plate, otherwise
+    // the first config matching the model. NotFound if neither matches.
+    size_t Find(uint32_t modelHash, const std::string& plate) const;
+
+    // Plates are compared case-insensitively.
+    static std::string NormalizePlate(const std::string& plate);
+
+private:
+    struct SPlateKey {
+        uint32_t Model;
+        std::string Plate;
+
+        bool operator==(const SPlateKey& other) const {
+            return Model == other.Model && Plate == other.Plate;
+        }
+    };
+
+    struct SPlateKeyHasher {
+        size_t operator()(const SPlateKey& key) const {
+            return std::hash<uint32_t>()(key.Model) ^
+                (std::hash<std::string>()(key.Plate) << 1);
+        }
+    };
+
+    std::unordered_map<uint32_t, size_t> mModels;
+    std::unordered_map<SPlateKey, size_t, SPlateKeyHasher> mPlates;
+};
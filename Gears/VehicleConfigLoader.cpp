@@ -0,0 +1,514 @@
+#include "VehicleConfigLoader.h"
+
+#include "Util/Logger.hpp"
+#include "Util/Strings.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <thread>
+#include <type_traits>
+#include <unordered_map>
+
+namespace fs = std::filesystem;
+
+namespace {
+    struct SFileStamp {
+        fs::file_time_type Time{};
+        uintmax_t Size = 0;
+
+        bool operator==(const SFileStamp& other) const {
+            return Time == other.Time && Size == other.Size;
+        }
+    };
+
+    template <typename F>
+    void forEachBlock(VehicleConfig& config, F&& func) {
+        func(&config.MTOptions, sizeof(config.MTOptions));
+        func(&config.MTParams, sizeof(config.MTParams));
+        func(&config.DriveAssists, sizeof(config.DriveAssists));
+        func(&config.ShiftOptions, sizeof(config.ShiftOptions));
+        func(&config.AutoParams, sizeof(config.AutoParams));
+        func(&config.Steering, sizeof(config.Steering));
+        func(&config.Misc, sizeof(config.Misc));
+    }
+
+    // A config as it was parsed from its file. Hotkeys and the menu change
+    // the live configs without saving, so only snapshots go into the cache.
+    struct SConfigSnapshot {
+        std::string Name;
+        std::string Description;
+        std::vector<std::string> ModelNames;
+        std::vector<std::string> Plates;
+        // The option blocks, back to back.
+        std::string Blocks;
+    };
+
+    std::string getBlocks(VehicleConfig& config) {
+        std::string blocks;
+        forEachBlock(config, [&blocks](void* block, size_t size) {
+            blocks.append(static_cast<const char*>(block), size);
+        });
+        return blocks;
+    }
+
+    SConfigSnapshot takeSnapshot(VehicleConfig& config) {
+        return { config.Name, config.Description, config.ModelNames, config.Plates, getBlocks(config) };
+    }
+
+    void applySnapshot(const SConfigSnapshot& snapshot, VehicleConfig& config) {
+        config.Name = snapshot.Name;
+        config.Description = snapshot.Description;
+        config.ModelNames = snapshot.ModelNames;
+        config.Plates = snapshot.Plates;
+        size_t offset = 0;
+        forEachBlock(config, [&snapshot, &offset](void* block, size_t size) {
+            memcpy(block, snapshot.Blocks.data() + offset, size);
+            offset += size;
+        });
+    }
+
+    // Whether the config was changed at runtime since it was parsed.
+    // Compares the raw blocks, so this may also report changes that only
+    // touched padding. That only costs a reparse.
+    bool editedSince(const SConfigSnapshot& snapshot, VehicleConfig& config) {
+        return getBlocks(config) != snapshot.Blocks;
+    }
+
+    struct SManifestEntry {
+        SFileStamp Stamp;
+        uint64_t Hash = 0;
+        // False when the file had no model names or plates.
+        bool Valid = false;
+        // Only set for valid entries.
+        SConfigSnapshot Snapshot;
+    };
+
+    std::unordered_map<std::string, SManifestEntry> manifest;
+    SManifestEntry baseEntry;
+
+    bool getStamp(const fs::path& path, SFileStamp& stamp) {
+        std::error_code ec;
+        auto time = fs::last_write_time(path, ec);
+        if (ec)
+            return false;
+        auto size = fs::file_size(path, ec);
+        if (ec)
+            return false;
+        stamp = { time, size };
+        return true;
+    }
+
+    // FNV-1a, as hashes are stored in the cache and need to be stable between runs.
+    uint64_t getHash(const std::string& path) {
+        std::ifstream file(path, std::ios::binary);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (char c : buffer.str()) {
+            hash ^= static_cast<uint8_t>(c);
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+
+    // Saving from the menu rewrites files without changing them, so when
+    // the time or size differs, the contents decide. Sets restamped when
+    // only the stamp moved, so the cache gets the new one.
+    bool unchanged(const std::string& path, const SFileStamp& stamp, SManifestEntry& entry, bool& restamped) {
+        if (entry.Stamp == stamp)
+            return true;
+
+        uint64_t hash = getHash(path);
+        if (hash != entry.Hash)
+            return false;
+
+        entry.Stamp = stamp;
+        restamped = true;
+        return true;
+    }
+
+    struct SFile {
+        std::string Path;
+        SFileStamp Stamp;
+    };
+
+    struct SJob {
+        const SFile* File = nullptr;
+        uint64_t Hash = 0;
+        VehicleConfig Config;
+        SConfigSnapshot Snapshot;
+    };
+
+    void parseAll(std::vector<SJob>& jobs, VehicleConfig* baseConfig) {
+        if (jobs.empty())
+            return;
+
+        // The base config is only read while parsing, so workers can share it.
+        std::atomic<size_t> next = 0;
+        auto worker = [&jobs, &next, baseConfig]() {
+            for (size_t i = next++; i < jobs.size(); i = next++) {
+                jobs[i].Hash = getHash(jobs[i].File->Path);
+                jobs[i].Config.SetFiles(baseConfig, jobs[i].File->Path);
+                jobs[i].Config.LoadSettings();
+                jobs[i].Snapshot = takeSnapshot(jobs[i].Config);
+            }
+        };
+
+        size_t numThreads = std::max(1u, std::thread::hardware_concurrency());
+        numThreads = std::min(numThreads, jobs.size());
+
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads - 1);
+        for (size_t i = 1; i < numThreads; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    /*
+     * Config cache
+     * The snapshots of the parsed configs are stored with the manifest, so
+     * a start without changed files doesn't need to parse any INI.
+     * The option blocks of VehicleConfig only hold Tracked<T> of plain types,
+     * so they're stored as raw bytes. The header carries the build time and
+     * the block sizes, so a cache from another build is never read.
+     */
+    const uint32_t cacheMagic = 0x4356544D; // "MTVC"
+    const uint32_t cacheVersion = 2;
+    const char* cacheBuild = __DATE__ " " __TIME__;
+
+    static_assert(std::is_trivially_copyable_v<decltype(VehicleConfig::MTOptions)>);
+    static_assert(std::is_trivially_copyable_v<decltype(VehicleConfig::MTParams)>);
+    static_assert(std::is_trivially_copyable_v<decltype(VehicleConfig::DriveAssists)>);
+    static_assert(std::is_trivially_copyable_v<decltype(VehicleConfig::ShiftOptions)>);
+    static_assert(std::is_trivially_copyable_v<decltype(VehicleConfig::AutoParams)>);
+    static_assert(std::is_trivially_copyable_v<decltype(VehicleConfig::Steering)>);
+    static_assert(std::is_trivially_copyable_v<decltype(VehicleConfig::Misc)>);
+
+    uint32_t blocksSize() {
+        static const uint32_t size = [] {
+            VehicleConfig config;
+            return static_cast<uint32_t>(getBlocks(config).size());
+        }();
+        return size;
+    }
+
+    class CacheWriter {
+    public:
+        template <typename T>
+        void Write(const T& value) {
+            static_assert(std::is_trivially_copyable_v<T>);
+            Bytes(&value, sizeof(T));
+        }
+
+        void Write(const std::string& value) {
+            Write(static_cast<uint32_t>(value.size()));
+            Bytes(value.data(), value.size());
+        }
+
+        void Write(const std::vector<std::string>& values) {
+            Write(static_cast<uint32_t>(values.size()));
+            for (const auto& value : values) {
+                Write(value);
+            }
+        }
+
+        void Write(const SManifestEntry& entry) {
+            Write(static_cast<int64_t>(entry.Stamp.Time.time_since_epoch().count()));
+            Write(static_cast<uint64_t>(entry.Stamp.Size));
+            Write(entry.Hash);
+            Write(static_cast<uint8_t>(entry.Valid));
+            if (!entry.Valid)
+                return;
+
+            Write(entry.Snapshot.Name);
+            Write(entry.Snapshot.Description);
+            Write(entry.Snapshot.ModelNames);
+            Write(entry.Snapshot.Plates);
+            Bytes(entry.Snapshot.Blocks.data(), entry.Snapshot.Blocks.size());
+        }
+
+        void Bytes(const void* data, size_t size) {
+            const char* bytes = static_cast<const char*>(data);
+            mBuffer.insert(mBuffer.end(), bytes, bytes + size);
+        }
+
+        const std::string& Buffer() const { return mBuffer; }
+
+    private:
+        std::string mBuffer;
+    };
+
+    // Reads stop at the end of the buffer and mark the reader as failed.
+    class CacheReader {
+    public:
+        explicit CacheReader(const std::vector<char>& buffer)
+            : mBuffer(buffer), mOffset(0), mFailed(false) {}
+
+        template <typename T>
+        T Read() {
+            static_assert(std::is_trivially_copyable_v<T>);
+            T value{};
+            Bytes(&value, sizeof(T));
+            return value;
+        }
+
+        std::string ReadString() {
+            uint32_t size = Read<uint32_t>();
+            if (mFailed || size > mBuffer.size() - mOffset) {
+                mFailed = true;
+                return {};
+            }
+            std::string value(mBuffer.data() + mOffset, size);
+            mOffset += size;
+            return value;
+        }
+
+        std::vector<std::string> ReadStrings() {
+            uint32_t count = Read<uint32_t>();
+            std::vector<std::string> values;
+            for (uint32_t i = 0; i < count && !mFailed; ++i) {
+                values.push_back(ReadString());
+            }
+            return values;
+        }
+
+        SManifestEntry ReadEntry() {
+            SManifestEntry entry;
+            entry.Stamp.Time = fs::file_time_type(fs::file_time_type::duration(Read<int64_t>()));
+            entry.Stamp.Size = static_cast<uintmax_t>(Read<uint64_t>());
+            entry.Hash = Read<uint64_t>();
+            entry.Valid = Read<uint8_t>() != 0;
+            if (!entry.Valid)
+                return entry;
+
+            entry.Snapshot.Name = ReadString();
+            entry.Snapshot.Description = ReadString();
+            entry.Snapshot.ModelNames = ReadStrings();
+            entry.Snapshot.Plates = ReadStrings();
+            entry.Snapshot.Blocks.resize(blocksSize());
+            Bytes(entry.Snapshot.Blocks.data(), entry.Snapshot.Blocks.size());
+            return entry;
+        }
+
+        void Bytes(void* data, size_t size) {
+            if (mFailed || size > mBuffer.size() - mOffset) {
+                mFailed = true;
+                return;
+            }
+            memcpy(data, mBuffer.data() + mOffset, size);
+            mOffset += size;
+        }
+
+        bool Failed() const { return mFailed; }
+
+    private:
+        const std::vector<char>& mBuffer;
+        size_t mOffset;
+        bool mFailed;
+    };
+
+    // Fills the manifest and configs from the cache. Leaves both empty on failure.
+    bool readCache(const std::string& cacheFile, VehicleConfig* baseConfig, std::vector<VehicleConfig>& configs) {
+        std::ifstream file(cacheFile, std::ios::binary);
+        if (!file)
+            return false;
+
+        std::vector<char> buffer((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+        CacheReader reader(buffer);
+
+        if (reader.Read<uint32_t>() != cacheMagic ||
+            reader.Read<uint32_t>() != cacheVersion ||
+            reader.ReadString() != cacheBuild ||
+            reader.Read<uint32_t>() != blocksSize()) {
+            logger.Write(INFO, "[VehicleConfigLoader] Cache [%s] is from another version, ignoring", cacheFile.c_str());
+            return false;
+        }
+
+        SManifestEntry cachedBase = reader.ReadEntry();
+        uint32_t count = reader.Read<uint32_t>();
+
+        std::unordered_map<std::string, SManifestEntry> cachedManifest;
+        std::vector<VehicleConfig> cachedConfigs;
+        for (uint32_t i = 0; i < count && !reader.Failed(); ++i) {
+            std::string path = reader.ReadString();
+            SManifestEntry entry = reader.ReadEntry();
+            if (reader.Failed())
+                break;
+
+            if (entry.Valid) {
+                VehicleConfig config;
+                config.SetFiles(baseConfig, path);
+                applySnapshot(entry.Snapshot, config);
+                cachedConfigs.push_back(std::move(config));
+            }
+            cachedManifest[path] = std::move(entry);
+        }
+
+        if (reader.Failed()) {
+            logger.Write(WARN, "[VehicleConfigLoader] Cache [%s] is truncated, ignoring", cacheFile.c_str());
+            return false;
+        }
+
+        baseEntry = cachedBase;
+        manifest = std::move(cachedManifest);
+        configs = std::move(cachedConfigs);
+        return true;
+    }
+
+    void writeCache(const std::string& cacheFile) {
+        CacheWriter writer;
+        writer.Write(cacheMagic);
+        writer.Write(cacheVersion);
+        writer.Write(std::string(cacheBuild));
+        writer.Write(blocksSize());
+        writer.Write(baseEntry);
+        writer.Write(static_cast<uint32_t>(manifest.size()));
+
+        for (const auto& [path, entry] : manifest) {
+            writer.Write(path);
+            writer.Write(entry);
+        }
+
+        // Write to a temporary file first, so a crash doesn't leave a broken cache.
+        const std::string tempFile = cacheFile + ".tmp";
+        {
+            std::ofstream file(tempFile, std::ios::binary | std::ios::trunc);
+            if (!file) {
+                logger.Write(WARN, "[VehicleConfigLoader] Failed to write cache [%s]", cacheFile.c_str());
+                return;
+            }
+            file.write(writer.Buffer().data(), static_cast<std::streamsize>(writer.Buffer().size()));
+        }
+
+        std::error_code ec;
+        fs::rename(tempFile, cacheFile, ec);
+        if (ec) {
+            logger.Write(WARN, "[VehicleConfigLoader] Failed to replace cache [%s]: %s",
+                cacheFile.c_str(), ec.message().c_str());
+        }
+    }
+}
+
+VehicleConfigLoader::SStats VehicleConfigLoader::Load(const std::string& directory,
+    VehicleConfig* baseConfig, std::vector<VehicleConfig>& configs, const std::string& cacheFile) {
+    SStats stats;
+
+    // Nothing loaded yet, so try to start from the cache.
+    bool useCache = !cacheFile.empty();
+    bool coldStart = manifest.empty() && configs.empty();
+    if (useCache && coldStart) {
+        stats.FromCache = readCache(cacheFile, baseConfig, configs);
+    }
+
+    // Configs inherit unset values from the base config, so all of them
+    // need parsing again when it changed.
+    bool restamped = false;
+    SFileStamp baseStamp;
+    if (baseConfig && getStamp(baseConfig->mFile, baseStamp) &&
+        !unchanged(baseConfig->mFile, baseStamp, baseEntry, restamped)) {
+        manifest.clear();
+        baseEntry = { baseStamp, getHash(baseConfig->mFile), true, {} };
+    }
+
+    std::vector<SFile> files;
+    for (auto& file : fs::directory_iterator(directory)) {
+        if (StrUtil::toLower(fs::path(file).extension().string()) != ".ini")
+            continue;
+
+        if (StrUtil::toLower(fs::path(file).stem().string()) == "basevehicleconfig")
+            continue;
+
+        SFile entry{ file.path().string() };
+        if (!getStamp(file.path(), entry.Stamp))
+            continue;
+        files.push_back(std::move(entry));
+    }
+
+    std::unordered_map<std::string, size_t> previous;
+    for (size_t i = 0; i < configs.size(); ++i) {
+        previous.emplace(configs[i].mFile, i);
+    }
+
+    // Files are kept in directory order, which decides which config wins a match.
+    std::vector<SJob> jobs;
+    std::vector<size_t> jobIndex(files.size(), SIZE_MAX);
+    std::vector<size_t> reuseIndex(files.size(), SIZE_MAX);
+    for (size_t i = 0; i < files.size(); ++i) {
+        auto manifestIt = manifest.find(files[i].Path);
+        if (manifestIt != manifest.end() && unchanged(files[i].Path, files[i].Stamp, manifestIt->second, restamped)) {
+            if (!manifestIt->second.Valid) {
+                ++stats.Skipped;
+                continue;
+            }
+            // Edited configs are parsed again, so a reload drops unsaved changes.
+            auto previousIt = previous.find(files[i].Path);
+            if (previousIt != previous.end() &&
+                !editedSince(manifestIt->second.Snapshot, configs[previousIt->second])) {
+                reuseIndex[i] = previousIt->second;
+                continue;
+            }
+        }
+        jobIndex[i] = jobs.size();
+        jobs.push_back(SJob{ &files[i] });
+    }
+
+    parseAll(jobs, baseConfig);
+
+    std::vector<VehicleConfig> result;
+    result.reserve(files.size());
+    std::unordered_map<std::string, SManifestEntry> newManifest;
+    for (size_t i = 0; i < files.size(); ++i) {
+        const auto& file = files[i];
+        if (jobIndex[i] == SIZE_MAX) {
+            // Unchanged, either reused or skipped before.
+            newManifest.emplace(file.Path, std::move(manifest[file.Path]));
+            if (reuseIndex[i] != SIZE_MAX) {
+                result.push_back(std::move(configs[reuseIndex[i]]));
+                ++stats.Reused;
+            }
+            continue;
+        }
+
+        auto& job = jobs[jobIndex[i]];
+        auto& config = job.Config;
+        bool valid = !config.ModelNames.empty() || !config.Plates.empty();
+        newManifest.emplace(file.Path, SManifestEntry{ file.Stamp, job.Hash, valid,
+            valid ? std::move(job.Snapshot) : SConfigSnapshot{} });
+        ++stats.Parsed;
+
+        if (!valid) {
+            logger.Write(WARN,
+                "Vehicle settings file [%s] contained no model names or plates, skipping...",
+                file.Path.c_str());
+            ++stats.Skipped;
+            continue;
+        }
+
+        logger.Write(DEBUG, "Loaded vehicle config [%s]", config.Name.c_str());
+        result.push_back(std::move(config));
+    }
+
+    bool changed = stats.Parsed > 0 || restamped || newManifest.size() != manifest.size();
+
+    configs = std::move(result);
+    manifest = std::move(newManifest);
+
+    if (useCache && (changed || (coldStart && !stats.FromCache)))
+        writeCache(cacheFile);
+    return stats;
+}
+
+void VehicleConfigLoader::Invalidate() {
+    manifest.clear();
+    baseEntry = {};
+}
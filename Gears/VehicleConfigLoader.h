@@ -0,0 +1,30 @@
+#pragma once
+#include "VehicleConfig.h"
+
+#include <string>
+#include <vector>
+
+// Loads the vehicle configs in a directory, parsing files on worker threads.
+// Keeps a manifest of file times, sizes and content hashes, so a reload only
+// parses files that were added or changed, and drops configs whose files were removed.
+// Configs with unsaved runtime changes are parsed again, like every config used to be.
+namespace VehicleConfigLoader {
+    struct SStats {
+        size_t Parsed = 0;
+        size_t Reused = 0;
+        size_t Skipped = 0;
+        // Whether the manifest and unchanged configs came from the cache file.
+        bool FromCache = false;
+    };
+
+    // configs holds the result of the previous load, unchanged entries are moved over.
+    // Pointers into configs are invalid afterwards.
+    // Files without model names or plates are skipped, like before.
+    // cacheFile: Where the parsed configs are stored between runs, so the first
+    //            load can skip parsing unchanged files. Empty disables the cache.
+    SStats Load(const std::string& directory, VehicleConfig* baseConfig,
+        std::vector<VehicleConfig>& configs, const std::string& cacheFile = {});
+
+    // Forgets the manifest, so the next Load parses every file.
+    void Invalidate();
+}
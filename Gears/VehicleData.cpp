@@ -5,6 +5,7 @@
 #include "Memory/Offsets.hpp"
 #include "Memory/Versions.h"
 #include "Util/MathExt.h"
+#include "Util/EntityCache.h"
 
 #include "ScriptSettings.hpp"
 
@@ -42,6 +43,7 @@ VehicleData::VehicleData()
     , mIsElectric(false), mIsCVT(false), mHasClutch(false)
     , mHasABS(false), mABSType()
     , mClass(), mDomain(), mIsAmphibious(false), mIsRhd(false)
+    , mSteeringWheelBone(-1), mHasEquipment(false)
     , mPrevVelocity() {}
 
 void VehicleData::SetVehicle(Vehicle v) {
@@ -56,9 +58,18 @@ void VehicleData::SetVehicle(Vehicle v) {
         mHasSpeedo = false;
         mIsRhd = GetIsRhd(v);
 
+        mSkeleton.SetVehicle(mVehicle);
+        mSteeringWheelBone = mSkeleton.GetBoneIndex("steeringwheel");
+        bool hasFork = mSkeleton.GetBoneIndex("forks") != -1;
+        bool hasTow = mSkeleton.GetBoneIndex("tow_arm") != -1;
+        bool hasScoop = mSkeleton.GetBoneIndex("scoop") != -1;
+        bool hasFrame = mSkeleton.GetBoneIndex("frame_1") != -1 &&
+            mSkeleton.GetBoneIndex("frame_2") != -1;
+        mHasEquipment = hasFork || hasTow || hasScoop || hasFrame;
+
         // initialize prev's init state
-        mVelocity = ENTITY::GET_ENTITY_SPEED_VECTOR(mVehicle, true);
-        mRPM = VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(mVehicle) ?
+        mVelocity = EntityCache::GetSpeedVector(mVehicle);
+        mRPM = EntityCache::GetEngineRunning(mVehicle) ?
             VExt::GetCurrentRPM(mVehicle) : 0.01f;
         mSuspensionTravel = VExt::GetWheelCompressions(mVehicle);
 
@@ -84,9 +95,15 @@ void VehicleData::SetVehicle(Vehicle v) {
         mWheelsAbs.resize(VExt::GetNumWheels(mVehicle));
         mWheelsEspO.resize(VExt::GetNumWheels(mVehicle));
         mWheelsEspU.resize(VExt::GetNumWheels(mVehicle));
-        mSuspensionTravelSpeedsHistory.clear();
+        mSuspensionTravelSpeedsFilter.Reset();
         Update();
     }
+    else {
+        // Don't keep pointers into a vehicle that may be gone.
+        mSkeleton.SetVehicle(0);
+        mSteeringWheelBone = -1;
+        mHasEquipment = false;
+    }
 }
 
 void VehicleData::Update() {
@@ -99,8 +116,8 @@ void VehicleData::Update() {
     mPrevSuspensionTravel = mSuspensionTravel;
 
     // Get current values
-    mVelocity = ENTITY::GET_ENTITY_SPEED_VECTOR(mVehicle, true);
-    mRPM = VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(mVehicle) ?
+    mVelocity = EntityCache::GetSpeedVector(mVehicle);
+    mRPM = EntityCache::GetEngineRunning(mVehicle) ?
         VExt::GetCurrentRPM(mVehicle) : 0.01f;
     mClutch = VExt::GetClutch(mVehicle);
     mThrottle = VExt::GetThrottle(mVehicle);
@@ -121,6 +138,7 @@ void VehicleData::Update() {
 
     mWheelCount = VExt::GetNumWheels(mVehicle);
     mWheelTyreSpeeds = VExt::GetTyreSpeeds(mVehicle);
+    mWheelRotationSpeeds = VExt::GetWheelRotationSpeeds(mVehicle);
 
     mWheelsOnGround = VExt::GetWheelsOnGround(mVehicle);
     mWheelSteeringAngles = VExt::GetWheelSteeringAngles(mVehicle);
@@ -139,23 +157,10 @@ void VehicleData::Update() {
     mSuspensionTravelSpeeds = getSuspensionTravelSpeeds();
     mAcceleration = getAcceleration();
 
-    mSuspensionTravelSpeedsHistory.push_back(mSuspensionTravelSpeeds);
-    while (mSuspensionTravelSpeedsHistory.size() > g_settings.Wheel.FFB.DetailMAW) {
-        mSuspensionTravelSpeedsHistory.erase(mSuspensionTravelSpeedsHistory.begin());
-    }
-
-    std::vector<float> averageSpeeds(mSuspensionTravelSpeedsHistory[0].size());
-    for (size_t i = 0; i < mSuspensionTravelSpeedsHistory.size(); ++i) {
-        auto speeds = mSuspensionTravelSpeedsHistory[i];
-        for (size_t wheelIdx = 0; wheelIdx < speeds.size(); ++wheelIdx) {
-            averageSpeeds[wheelIdx] += speeds[wheelIdx];
-        }
-    }
-    for(size_t i = 0; i < averageSpeeds.size(); ++i) {
-        averageSpeeds[i] /= static_cast<float>(g_settings.Wheel.FFB.DetailMAW);
-    }
-
-    mSuspensionTravelSpeeds = averageSpeeds;
+    mSuspensionTravelSpeedsFilter.Configure(
+        static_cast<WheelFilter::EShape>(g_settings.Wheel.FFB.DetailFilter),
+        g_settings.Wheel.FFB.DetailMAW);
+    mSuspensionTravelSpeedsFilter.Update(mSuspensionTravelSpeeds);
 }
 
 std::vector<bool> VehicleData::getDrivenWheels() {
@@ -182,8 +187,7 @@ float VehicleData::getAverageDrivenWheelTyreSpeeds() {
 
 std::vector<bool> VehicleData::getWheelsLockedUp() {
     std::vector<bool> lockups;
-    auto wheelsSpeed = VExt::GetWheelRotationSpeeds(mVehicle);
-    for (auto wheelSpeed : wheelsSpeed) {
+    for (auto wheelSpeed : mWheelRotationSpeeds) {
         if (abs(mVelocity.y) > 0.01f && wheelSpeed == 0.0f)
             lockups.push_back(true);
         else
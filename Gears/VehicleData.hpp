@@ -5,7 +5,9 @@
 #include <vector>
 #include <chrono>
 #include "Memory/VehicleExtensions.hpp"
+#include "Memory/VehicleBone.h"
 #include "AtcuGearbox.h"
+#include "Util/WheelFilter.h"
 
 enum class VehicleClass {
     Car,
@@ -65,7 +67,7 @@ struct VehicleGearboxStates {
     bool FakeNeutral = false;
     bool HitRPMSpeedLimiter = false; // Limit speed at top RPM
     bool HitRPMLimiter = false; // Limit RPM so it doesn't >1.0f
-    int LastRedline = 0;
+    float RedlineTime = -1.0f; // Time since hitting the rev limiter, negative when not limiting, s
 
     // Delayed shifting
     bool Shifting = false; 
@@ -134,6 +136,7 @@ public:
     uint8_t mWheelCount;
     std::vector<bool> mWheelsDriven;
     std::vector<float> mWheelTyreSpeeds;
+    std::vector<float> mWheelRotationSpeeds;
     float mWheelAverageDrivenTyreSpeed;
 
     std::vector<bool> mWheelsLockedUp;
@@ -172,6 +175,11 @@ public:
     VehicleDomain mDomain;
     bool mIsAmphibious;
     bool mIsRhd;
+
+    VehicleBones::Skeleton mSkeleton;
+    int mSteeringWheelBone;
+    // Has forks, a tow arm, a scoop or a frame, which take the steering controls
+    bool mHasEquipment;
 private:
     std::vector<bool> getDrivenWheels();
     float getAverageDrivenWheelTyreSpeeds();
@@ -184,7 +192,7 @@ private:
     ABSType getABSType(uint32_t handlingFlags);
 
     std::vector<float> mPrevSuspensionTravel;
-    std::vector<std::vector<float>> mSuspensionTravelSpeedsHistory;
+    WheelFilter mSuspensionTravelSpeedsFilter;
 
     Vector3 mPrevVelocity;
 };
@@ -5,12 +5,15 @@
 #include "SteeringAnim.h"
 #include "ScriptSettings.hpp"
 #include "VehicleData.hpp"
+#include "DrivingAssists.h"
 #include "Input/CarControls.hpp"
 
 #include "Util/ScriptUtils.h"
 #include "Util/MathExt.h"
 #include "Util/MiscEnums.h"
 #include "Util/UIUtils.h"
+#include "Util/EntityCache.h"
+#include "Util/FastMath.h"
 
 #include "Memory/VehicleExtensions.hpp"
 #include "Memory/Offsets.hpp"
@@ -39,6 +42,10 @@ extern WheelPatchStates g_wheelPatchStates;
 
 namespace {
     MiniPID pid(1.0, 0.0, 0.0);
+
+    FastMath::GammaCurve throttleGamma;
+    FastMath::GammaCurve brakeGamma;
+    FastMath::GammaCurve steeringGamma;
 }
 
 namespace WheelInput {
@@ -111,8 +118,8 @@ bool hasAltInputs(Vehicle vehicle) {
 void WheelInput::HandlePedals(float wheelThrottleVal, float wheelBrakeVal) {
     bool altInput = hasAltInputs(g_playerVehicle);
 
-    wheelThrottleVal = pow(wheelThrottleVal, g_settings.Wheel.Throttle.Gamma);
-    wheelBrakeVal = pow(wheelBrakeVal, g_settings.Wheel.Brake.Gamma);
+    wheelThrottleVal = throttleGamma(wheelThrottleVal, g_settings.Wheel.Throttle.Gamma);
+    wheelBrakeVal = brakeGamma(wheelBrakeVal, g_settings.Wheel.Brake.Gamma);
 
     float speedThreshold = 0.5f;
     const float reverseThreshold = 2.0f;
@@ -227,7 +234,7 @@ void WheelInput::HandlePedals(float wheelThrottleVal, float wheelBrakeVal) {
         VExt::SetThrottleP(g_playerVehicle, -0.1f);
 
         // We're reversing
-        if (ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < -speedThreshold) {
+        if (EntityCache::GetSpeedVector(g_playerVehicle).y < -speedThreshold) {
             //UI::ShowText(0.3, 0.0, 1.0, "We are reversing");
             // Throttle Pedal Reverse
             if (wheelThrottleVal > 0.01f) {
@@ -242,7 +249,7 @@ void WheelInput::HandlePedals(float wheelThrottleVal, float wheelBrakeVal) {
         }
 
         // Standing still
-        if (ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < speedThreshold && ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y >= -speedThreshold) {
+        if (EntityCache::GetSpeedVector(g_playerVehicle).y < speedThreshold && EntityCache::GetSpeedVector(g_playerVehicle).y >= -speedThreshold) {
             //UI::ShowText(0.3, 0.0, 1.0, "We are stopped");
 
             if (wheelThrottleVal > 0.01f) {
@@ -257,11 +264,11 @@ void WheelInput::HandlePedals(float wheelThrottleVal, float wheelBrakeVal) {
         }
 
         // We're rolling forwards
-        if (ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y > speedThreshold) {
+        if (EntityCache::GetSpeedVector(g_playerVehicle).y > speedThreshold) {
             //UI::ShowText(0.3, 0.0, 1.0, "We are rolling forwards");
             //bool brakelights = false;
 
-            if (ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y > reverseThreshold) {
+            if (EntityCache::GetSpeedVector(g_playerVehicle).y > reverseThreshold) {
                 if (!isClutchPressed()) {
                     PAD::_SET_CONTROL_NORMAL(0, ControlVehicleHandbrake, 1.0f);
                 }
@@ -281,8 +288,8 @@ void WheelInput::HandlePedals(float wheelThrottleVal, float wheelBrakeVal) {
 // Pedals behave like RT/LT
 void WheelInput::HandlePedalsArcade(float wheelThrottleVal, float wheelBrakeVal) {
     bool altInput = hasAltInputs(g_playerVehicle);
-    wheelThrottleVal = pow(wheelThrottleVal, g_settings.Wheel.Throttle.Gamma);
-    wheelBrakeVal = pow(wheelBrakeVal, g_settings.Wheel.Brake.Gamma);
+    wheelThrottleVal = throttleGamma(wheelThrottleVal, g_settings.Wheel.Throttle.Gamma);
+    wheelBrakeVal = brakeGamma(wheelBrakeVal, g_settings.Wheel.Brake.Gamma);
 
     if (wheelThrottleVal > 0.01f) {
         SetControlADZAlt(ControlVehicleAccelerate, wheelThrottleVal, g_settings.Wheel.Throttle.AntiDeadZone, altInput);
@@ -485,8 +492,8 @@ void WheelInput::DoSteering() {
 
     float steerValL = map(g_controls.SteerVal, 0.0f, 0.5f, 1.0f, 0.0f);
     float steerValR = map(g_controls.SteerVal, 0.5f, 1.0f, 0.0f, 1.0f);
-    float steerValGammaL = pow(steerValL, g_settings.Wheel.Steering.Gamma);
-    float steerValGammaR = pow(steerValR, g_settings.Wheel.Steering.Gamma);
+    float steerValGammaL = steeringGamma(steerValL, g_settings.Wheel.Steering.Gamma);
+    float steerValGammaR = steeringGamma(steerValR, g_settings.Wheel.Steering.Gamma);
     float steerValGamma = g_controls.SteerVal < 0.5f ? -steerValGammaL : steerValGammaR;
     float effSteer = steerMult * steerValGamma;
 
@@ -495,10 +502,10 @@ void WheelInput::DoSteering() {
     if (g_vehData.mClass == VehicleClass::Car) {
         VExt::SetSteeringInputAngle(g_playerVehicle, -effSteer);
 
-        if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle))
+        if (!EntityCache::GetEngineRunning(g_playerVehicle))
             VExt::SetSteeringAngle(g_playerVehicle, -effSteer * VExt::GetMaxSteeringAngle(g_playerVehicle));
 
-        auto boneIdx = ENTITY::GET_ENTITY_BONE_INDEX_BY_NAME(g_playerVehicle, "steeringwheel");
+        auto boneIdx = g_vehData.mSteeringWheelBone;
         if (boneIdx != -1) {
             Vector3 rotAxis{};
             rotAxis.y = 1.0f;
@@ -513,7 +520,7 @@ void WheelInput::DoSteering() {
             // Not sure if this is the best solution, but hey, it works!
             rotDeg -= 2.0f * rad2deg(std::clamp(effSteer, -1.0f, 1.0f) * VExt::GetMaxSteeringAngle(g_playerVehicle));
 
-            VehicleBones::RotateAxis(g_playerVehicle, boneIdx, rotAxis, rotDeg);
+            g_vehData.mSkeleton.RotateAxis(boneIdx, rotAxis, rotDeg);
             SteeringAnimation::SetRotation(rotDegRaw);
         }
     }
@@ -530,7 +537,7 @@ int calculateDamper(float gain, float wheelsOffGroundRatio) {
     float damperMin = static_cast<float>(g_settings.Wheel.FFB.DamperMin);
     float damperMinSpeed = static_cast<float>(g_settings.Wheel.FFB.DamperMinSpeed);
 
-    float absVehicleSpeed = abs(ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y);
+    float absVehicleSpeed = abs(EntityCache::GetSpeedVector(g_playerVehicle).y);
     float damperFactorSpeed = map(absVehicleSpeed, 0.0f, damperMinSpeed, damperMax, damperMin);
     damperFactorSpeed = fmaxf(damperFactorSpeed, damperMin);
     // already clamped on the upper bound by abs(vel) in map()
@@ -545,20 +552,20 @@ int calculateDamper(float gain, float wheelsOffGroundRatio) {
     damperForce = damperForce * (1.0f - wheelsOffGroundRatio);
 
     if (g_vehData.mClass == VehicleClass::Car || g_vehData.mClass == VehicleClass::Quad) {
-        if (VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, 0, true)) {
+        if (EntityCache::GetTyreBurst(g_playerVehicle, 0, true)) {
             damperForce /= 2.0f;
         }
-        if (VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, 1, true)) {
+        if (EntityCache::GetTyreBurst(g_playerVehicle, 1, true)) {
             damperForce /= 2.0f;
         }
     }
     else if (g_vehData.mClass == VehicleClass::Bike) {
-        if (VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, 0, true)) {
+        if (EntityCache::GetTyreBurst(g_playerVehicle, 0, true)) {
             damperForce /= 4.0f;
         }
     }
 
-    if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+    if (!EntityCache::GetEngineRunning(g_playerVehicle)) {
         damperForce *= 2.0f;
     }
 
@@ -574,7 +581,7 @@ int calculateDamper(float gain, float wheelsOffGroundRatio) {
 int calculateDetail() {
     // Detail feel / suspension compression based
     float compSpeedTotal = 0.0f;
-    auto compSpeed = g_vehData.mSuspensionTravelSpeeds;
+    const auto& compSpeed = g_vehData.mSuspensionTravelSpeeds;
 
     // More than 2 wheels! Trikes should be ok, etc.
     if (compSpeed.size() > 2) {
@@ -615,36 +622,37 @@ void calculateSoftLock(int& totalForce, int& damperForce) {
 
 // Despite being scientifically inaccurate, "self-aligning torque" is the best description.
 int calculateSat(int defaultGain, float steeringAngle, float wheelsOffGroundRatio, bool isCar) {
-    float speed = ENTITY::GET_ENTITY_SPEED(g_playerVehicle);
+    const auto& dynamics = DrivingAssists::GetDynamics();
+    float speed = dynamics.Speed;
 
     const float maxSpeed = g_settings.Wheel.FFB.MaxSpeed;
     // gamma: should be < 1 for tapering off force when reaching maxSpeed
     //float spdMap = pow(std::min(speed, maxSpeed) / maxSpeed, g_settings.Wheel.FFB.Gamma) * maxSpeed / 2.0f;
-    float spdMap = pow(std::min(speed, maxSpeed * 2.0f) / (maxSpeed * 2.0f), g_settings.Wheel.FFB.Gamma) * maxSpeed;
+    float spdMap = FastMath::Pow(std::min(speed, maxSpeed * 2.0f) / (maxSpeed * 2.0f), g_settings.Wheel.FFB.Gamma) * maxSpeed;
     float spdRatio = spdMap / speed;
 
     if (speed == 0.0f)
         spdRatio = 1.0f;
 
-    Vector3 speedVector = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
+    Vector3 speedVector = dynamics.SpeedVector;
     Vector3 speedVectorMapped = speedVector;
     speedVectorMapped.x = speedVector.x * (spdRatio);
-    Vector3 rotVector = ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle);
+    Vector3 rotVector = dynamics.RotationVelocity;
     Vector3 rotRelative{
-        speed * -sin(rotVector.z), 0,
-        speed * cos(rotVector.z), 0,
+        speed * -FastMath::Sin(rotVector.z), 0,
+        speed * FastMath::Cos(rotVector.z), 0,
         0, 0
     };
 
     Vector3 expectedVectorMapped{
-        spdMap * -sin(steeringAngle / g_settings().Steering.Wheel.SteeringMult), 0,
-        spdMap * cos(steeringAngle /  g_settings().Steering.Wheel.SteeringMult), 0,
+        spdMap * -FastMath::Sin(steeringAngle / g_settings().Steering.Wheel.SteeringMult), 0,
+        spdMap * FastMath::Cos(steeringAngle /  g_settings().Steering.Wheel.SteeringMult), 0,
         0, 0
     };
 
     Vector3 expectedVector{
-        speed * -sin(steeringAngle / g_settings().Steering.Wheel.SteeringMult), 0,
-        speed * cos(steeringAngle /  g_settings().Steering.Wheel.SteeringMult), 0,
+        speed * -FastMath::Sin(steeringAngle / g_settings().Steering.Wheel.SteeringMult), 0,
+        speed * FastMath::Cos(steeringAngle /  g_settings().Steering.Wheel.SteeringMult), 0,
         0, 0
     };
     
@@ -663,12 +671,12 @@ int calculateSat(int defaultGain, float steeringAngle, float wheelsOffGroundRati
         float avgAngle = VExt::GetWheelAverageAngle(g_playerVehicle) * g_settings().Steering.Wheel.SteeringMult;
 
         Vector3 vecPredStr{
-            speed * -sin(avgAngle / g_settings().Steering.Wheel.SteeringMult), 0,
-            speed * cos(avgAngle /  g_settings().Steering.Wheel.SteeringMult), 0,
+            speed * -FastMath::Sin(avgAngle / g_settings().Steering.Wheel.SteeringMult), 0,
+            speed * FastMath::Cos(avgAngle /  g_settings().Steering.Wheel.SteeringMult), 0,
             0, 0
         };
 
-        Vector3 vecNextSpd = ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true);
+        Vector3 vecNextSpd = dynamics.SpeedVector;
         Vector3 vecNextRot = (vecNextSpd + rotRelative) * 0.5f;
         float understeerAngle = GetAngleBetween(vecNextRot, vecPredStr);
 
@@ -690,15 +698,15 @@ int calculateSat(int defaultGain, float steeringAngle, float wheelsOffGroundRati
     satForce = static_cast<float>(satForce) * (1.0f - wheelsOffGroundRatio);
 
     if (g_vehData.mClass == VehicleClass::Car || g_vehData.mClass == VehicleClass::Quad) {
-        if (VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, 0, true)) {
+        if (EntityCache::GetTyreBurst(g_playerVehicle, 0, true)) {
             satForce = satForce / 4.0f;
         }
-        if (VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, 1, true)) {
+        if (EntityCache::GetTyreBurst(g_playerVehicle, 1, true)) {
             satForce = satForce / 4.0f;
         }
     }
     else if (g_vehData.mClass == VehicleClass::Bike) {
-        if (VEHICLE::IS_VEHICLE_TYRE_BURST(g_playerVehicle, 0, true)) {
+        if (EntityCache::GetTyreBurst(g_playerVehicle, 0, true)) {
             satForce = satForce / 10.0f;
         }
     }
@@ -728,19 +736,19 @@ int calculateSat(int defaultGain, float steeringAngle, float wheelsOffGroundRati
 void WheelInput::DrawDebugLines() {
     float steeringAngle = VExt::GetWheelAverageAngle(g_playerVehicle) * VExt::GetSteeringMultiplier(g_playerVehicle);
     Vector3 velocityWorld = ENTITY::GET_ENTITY_VELOCITY(g_playerVehicle);
-    Vector3 positionWorld = ENTITY::GET_ENTITY_COORDS(g_playerVehicle, 1);
+    Vector3 positionWorld = EntityCache::GetCoords(g_playerVehicle);
     Vector3 travelWorld = velocityWorld + positionWorld;
     Vector3 travelRelative = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(g_playerVehicle, travelWorld.x, travelWorld.y, travelWorld.z);
 
-    Vector3 rotationVelocity = ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle);
-    Vector3 turnWorld = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, ENTITY::GET_ENTITY_SPEED(g_playerVehicle) * -sin(rotationVelocity.z), ENTITY::GET_ENTITY_SPEED(g_playerVehicle) * cos(rotationVelocity.z), 0.0f);
+    Vector3 rotationVelocity = EntityCache::GetRotationVelocity(g_playerVehicle);
+    Vector3 turnWorld = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, EntityCache::GetSpeed(g_playerVehicle) * -sin(rotationVelocity.z), EntityCache::GetSpeed(g_playerVehicle) * cos(rotationVelocity.z), 0.0f);
     Vector3 turnRelative = ENTITY::GET_OFFSET_FROM_ENTITY_GIVEN_WORLD_COORDS(g_playerVehicle, turnWorld.x, turnWorld.y, turnWorld.z);
     float turnRelativeNormX = (travelRelative.x + turnRelative.x) / 2.0f;
     float turnRelativeNormY = (travelRelative.y + turnRelative.y) / 2.0f;
     Vector3 turnWorldNorm = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, turnRelativeNormX, turnRelativeNormY, 0.0f);
 
-    float steeringAngleRelX = ENTITY::GET_ENTITY_SPEED(g_playerVehicle) * -sin(steeringAngle);
-    float steeringAngleRelY = ENTITY::GET_ENTITY_SPEED(g_playerVehicle) * cos(steeringAngle);
+    float steeringAngleRelX = EntityCache::GetSpeed(g_playerVehicle) * -sin(steeringAngle);
+    float steeringAngleRelY = EntityCache::GetSpeed(g_playerVehicle) * cos(steeringAngle);
     Vector3 steeringWorld = ENTITY::GET_OFFSET_FROM_ENTITY_IN_WORLD_COORDS(g_playerVehicle, steeringAngleRelX, steeringAngleRelY, 0.0f);
 
     GRAPHICS::DRAW_LINE(positionWorld.x, positionWorld.y, positionWorld.z, travelWorld.x, travelWorld.y, travelWorld.z, 0, 255, 0, 255);
@@ -853,7 +861,7 @@ void WheelInput::PlayFFBWater() {
     bool isInWater = ENTITY::GET_ENTITY_SUBMERGED_LEVEL(g_playerVehicle) > 0.10f;
     int damperForce = calculateDamper(50.0f, isInWater ? 0.25f : 1.0f);
     int detailForce = calculateDetail();
-    int satForce = calculateSat(750, ENTITY::GET_ENTITY_ROTATION_VELOCITY(g_playerVehicle).z, 1.0f, false);
+    int satForce = calculateSat(750, DrivingAssists::GetDynamics().YawRate, 1.0f, false);
 
     if (!isInWater) {
         satForce = 0;
@@ -9,6 +9,8 @@
 #include "WheelInput.h"
 #include "SteeringAnim.h"
 #include "VehicleConfig.h"
+#include "VehicleConfigIndex.h"
+#include "VehicleConfigLoader.h"
 #include "AtcuLogic.h"
 #include "Camera.h"
 #include "Misc.h"
@@ -38,6 +40,11 @@
 #include "Util/GameSound.h"
 #include "Util/SysUtils.h"
 #include "Util/Strings.hpp"
+#include "Util/NativeProfiler.h"
+#include "Util/EntityCache.h"
+#include "Util/FastMath.h"
+#include "Util/FileWatcher.h"
+#include "Util/FixedStep.h"
 
 #include <GTAVDashHook/DashHook/DashHook.h>
 #include <menu.h>
@@ -91,6 +98,16 @@ WheelPatchStates g_wheelPatchStates;
 VehicleData g_vehData;
 
 std::vector<VehicleConfig> g_vehConfigs;
+VehicleConfigIndex g_vehConfigIndex;
+// Counts reloads, as a reload can put a new config at an old address.
+uint32_t g_vehConfigsGeneration = 0;
+
+FileWatcher g_settingsWatcher;
+FileWatcher g_vehConfigsWatcher;
+
+// Gearbox state that integrates over time runs on fixed steps,
+// so shifts, stalls and the rev limiter don't change with frame rate.
+FixedStep g_gearboxStep;
 
 bool g_focused;
 Timer g_wheelInitDelayTimer(0);
@@ -176,7 +193,7 @@ void functionDash() {
         data.oilPressure = lerp(
             data.oilPressure,
             AWD::GetTransferValue(),
-            1.0f - pow(0.0001f, MISC::GET_FRAME_TIME()));
+            1.0f - FastMath::Pow(0.0001f, MISC::GET_FRAME_TIME()));
 
         // oil pressure gauge uses data.temp
         // battery voltage uses data.temp
@@ -185,77 +202,42 @@ void functionDash() {
     DashHook_SetData(data);
 }
 
-void setVehicleConfig(Vehicle vehicle) {
-    std::string oldName;
-    if (g_settings.ConfigActive()) {
-        oldName = g_settings().Name;
-    }
-
+// oldName: The previously active config, only notifies when the new one differs.
+void setVehicleConfig(Vehicle vehicle, const std::string& oldName) {
     g_settings.SetVehicleConfig(nullptr);
 
     if (ENTITY::DOES_ENTITY_EXIST(vehicle)) {
         auto currModel = ENTITY::GET_ENTITY_MODEL(vehicle);
-        auto itModelMatch = std::find_if(g_vehConfigs.begin(), g_vehConfigs.end(),
-            [currModel, vehicle](const VehicleConfig & config) {
-                auto modelsIt = std::find_if(config.ModelNames.begin(), config.ModelNames.end(),
-                    [currModel](const std::string & modelName) {
-                        return joaat(modelName.c_str()) == currModel;
-                    });
-                if (modelsIt != config.ModelNames.end())
-                    return true;
-                return false;
-            });
-
-        auto itPlateMatch = std::find_if(g_vehConfigs.begin(), g_vehConfigs.end(),
-            [currModel, vehicle](const VehicleConfig& config) {
-                auto modelsIt = std::find_if(config.ModelNames.begin(), config.ModelNames.end(),
-                    [currModel](const std::string& modelName) {
-                        return joaat(modelName.c_str()) == currModel;
-                    });
-                auto platesIt = std::find_if(config.Plates.begin(), config.Plates.end(),
-                    [vehicle](const std::string& plate) {
-                        return StrUtil::toLower(plate) == StrUtil::toLower(VEHICLE::GET_VEHICLE_NUMBER_PLATE_TEXT(vehicle));
-                    });
-                if (platesIt != config.Plates.end() && modelsIt != config.ModelNames.end())
-                    return true;
-                return false;
-            });
-
-        auto itMatch = itPlateMatch;
-        if (itMatch == g_vehConfigs.end())
-            itMatch = itModelMatch;
-
-        if (itMatch != g_vehConfigs.end()) {
-            g_settings.SetVehicleConfig(&*itMatch);
-            if (itMatch->Name != oldName) {
-                UI::Notify(INFO, fmt::format("Configuration [{}] loaded.", itMatch->Name));
+        std::string plate = VEHICLE::GET_VEHICLE_NUMBER_PLATE_TEXT(vehicle);
+
+        size_t matchIdx = g_vehConfigIndex.Find(currModel, plate);
+        if (matchIdx != VehicleConfigIndex::NotFound) {
+            auto& config = g_vehConfigs[matchIdx];
+            g_settings.SetVehicleConfig(&config);
+            if (config.Name != oldName) {
+                UI::Notify(INFO, fmt::format("Configuration [{}] loaded.", config.Name));
             }
         }
     }
 }
 
+void setVehicleConfig(Vehicle vehicle) {
+    std::string oldName;
+    if (g_settings.ConfigActive()) {
+        oldName = g_settings().Name;
+    }
+    setVehicleConfig(vehicle, oldName);
+}
+
 void update_player() {
     g_player = PLAYER::PLAYER_ID();
     g_playerPed = PLAYER::PLAYER_PED_ID();
 }
 
 void updateActiveSteeringAnim(Vehicle vehicle) {
-    const auto& anims = SteeringAnimation::GetAnimations();
-    auto layoutHash = VEHICLE::GET_VEHICLE_LAYOUT_HASH(vehicle);
-    size_t animIdx = anims.size();
-    for (size_t i = 0; i < anims.size(); ++i) {
-        bool found = false;
-        for (const std::string& layout : anims[i].Layouts) {
-            if (joaat(layout.c_str()) == layoutHash) {
-                animIdx = i;
-                found = true;
-                break;
-            }
-        }
-        if (found)
-            break;
-    }
-    if (animIdx == anims.size() && layoutHash != 0) {
+    auto layoutHash = static_cast<uint32_t>(VEHICLE::GET_VEHICLE_LAYOUT_HASH(vehicle));
+    size_t animIdx = SteeringAnimation::FindAnimation(layoutHash);
+    if (animIdx == SteeringAnimation::GetAnimations().size() && layoutHash != 0) {
         std::string msg = fmt::format("Animation: No valid animation found for layout hash 0x{:08X}", layoutHash);
         logger.Write(WARN, msg);
         UI::Notify(DEBUG, msg);
@@ -285,8 +267,9 @@ void update_vehicle() {
 
     if (vehAvail) {
         g_vehData.Update(); // Update before doing anything else
+        DrivingAssists::UpdateDynamics();
 
-        if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        if (EntityCache::GetEngineRunning(g_playerVehicle)) {
             g_peripherals.IgnitionState = IgnitionState::On;
         }
         else if (!(g_peripherals.IgnitionState == IgnitionState::Stall)) {
@@ -484,7 +467,7 @@ void update_manual_features() {
 
         // Simulate "catch point"
         // When the clutch "grabs" and the car starts moving without input
-        if (g_settings().MTOptions.ClutchCreep && VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+        if (g_settings().MTOptions.ClutchCreep && EntityCache::GetEngineRunning(g_playerVehicle)) {
             functionClutchCatch();
         }
     }
@@ -615,9 +598,7 @@ void update_manual_transmission() {
         UI::Notify(INFO, fmt::format("Assist: {}abled launch control", newValue ? "En" : "Dis"));
     }
 
-    if (MemoryPatcher::NumGearboxPatched != MemoryPatcher::NumGearboxPatches) {
-        MemoryPatcher::ApplyGearboxPatches();
-    }
+    MemoryPatcher::SetWanted(MemoryPatcher::EPatch::Gearbox, true);
     update_manual_features();
 
     switch(g_settings().MTOptions.ShiftMode) {
@@ -661,18 +642,11 @@ void update_manual_transmission() {
 
 void clearPatches() {
     resetSteeringMultiplier();
-    if (MemoryPatcher::NumGearboxPatched != 0) {
-        MemoryPatcher::RevertGearboxPatches();
-    }
-    if (MemoryPatcher::SteeringControlPatcher.Patched()) {
-        MemoryPatcher::RestoreSteeringControl();
-    }
-    if (MemoryPatcher::SteeringAssistPatcher.Patched()) {
-        MemoryPatcher::RestoreSteeringAssist();
-    }
-    if (MemoryPatcher::BrakePatcher.Patched()) {
-        MemoryPatcher::RestoreBrake();
-    }
+    MemoryPatcher::SetWanted(MemoryPatcher::EPatch::Gearbox, false);
+    MemoryPatcher::SetWanted(MemoryPatcher::EPatch::Steering, false);
+    MemoryPatcher::SetWanted(MemoryPatcher::EPatch::Brake, false);
+    // Callers like MT_SetActive expect the patches gone right away.
+    MemoryPatcher::ReconcilePatches();
 }
 
 void toggleManual(bool enable) {
@@ -710,23 +684,7 @@ void update_steering() {
         useWheel = false;
     }
 
-    if (isCar && (useWheel || customSteering)) {
-        if (!MemoryPatcher::SteeringAssistPatcher.Patched())
-            MemoryPatcher::PatchSteeringAssist();
-    }
-    else {
-        if (MemoryPatcher::SteeringAssistPatcher.Patched())
-            MemoryPatcher::RestoreSteeringAssist();
-    }
-
-    if (isCar && (useWheel || customSteering)) {
-        if (!MemoryPatcher::SteeringControlPatcher.Patched())
-            MemoryPatcher::PatchSteeringControl();
-    }
-    else {
-        if (MemoryPatcher::SteeringControlPatcher.Patched())
-            MemoryPatcher::RestoreSteeringControl();
-    }
+    MemoryPatcher::SetWanted(MemoryPatcher::EPatch::Steering, isCar && (useWheel || customSteering));
 
     if (Util::VehicleAvailable(g_playerVehicle, g_playerPed)) {
         updateSteeringMultiplier();
@@ -954,7 +912,7 @@ void updateShifting() {
      * 4.0 gives similar perf as base - probably the whole shift takes 1/rate seconds
      * with my extra disengage step, the whole thing should take also 1/rate seconds
      */
-    shiftRate = shiftRate * MISC::GET_FRAME_TIME() * 4.0f;
+    shiftRate = shiftRate * g_gearboxStep.StepSize() * 4.0f;
 
     // Something went wrong, abort and just shift to NextGear.
     if (g_gearStates.ClutchVal > 1.5f) {
@@ -964,20 +922,23 @@ void updateShifting() {
         return;
     }
 
-    if (g_gearStates.NextGear != g_gearStates.LockGear) {
-        g_gearStates.ClutchVal += shiftRate;
-    }
-    if (g_gearStates.ClutchVal >= 1.0f && g_gearStates.LockGear != g_gearStates.NextGear) {
-        g_gearStates.LockGear = g_gearStates.NextGear;
-        return;
-    }
-    if (g_gearStates.NextGear == g_gearStates.LockGear) {
-        g_gearStates.ClutchVal -= shiftRate;
-    }
+    for (uint32_t step = 0; step < g_gearboxStep.Steps() && g_gearStates.Shifting; ++step) {
+        if (g_gearStates.NextGear != g_gearStates.LockGear) {
+            g_gearStates.ClutchVal += shiftRate;
+        }
+        // The new gear has to reach the game with the clutch still out, so end this frame here.
+        if (g_gearStates.ClutchVal >= 1.0f && g_gearStates.LockGear != g_gearStates.NextGear) {
+            g_gearStates.LockGear = g_gearStates.NextGear;
+            return;
+        }
+        if (g_gearStates.NextGear == g_gearStates.LockGear) {
+            g_gearStates.ClutchVal -= shiftRate;
+        }
 
-    if (g_gearStates.ClutchVal < 0.0f && g_gearStates.NextGear == g_gearStates.LockGear) {
-        g_gearStates.ClutchVal = 0.0f;
-        g_gearStates.Shifting = false;
+        if (g_gearStates.ClutchVal < 0.0f && g_gearStates.NextGear == g_gearStates.LockGear) {
+            g_gearStates.ClutchVal = 0.0f;
+            g_gearStates.Shifting = false;
+        }
     }
 }
 
@@ -1163,7 +1124,7 @@ bool subAutoShiftSelect() {
         return true;
     }
     if (g_controls.ButtonJustPressed(CarControls::WheelControlType::AReverse)) {
-        if (ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < 5.0f) {
+        if (EntityCache::GetSpeedVector(g_playerVehicle).y < 5.0f) {
             shiftTo(0, false);
             g_gearStates.FakeNeutral = false;
         }
@@ -1219,7 +1180,7 @@ void functionAShift() {
     if (g_controls.ThrottleVal >= g_gearStates.ThrottleHang)
         g_gearStates.ThrottleHang = g_controls.ThrottleVal;
     else if (g_gearStates.ThrottleHang > 0.0f)
-        g_gearStates.ThrottleHang -= MISC::GET_FRAME_TIME() * g_settings().AutoParams.EcoRate;
+        g_gearStates.ThrottleHang -= g_gearboxStep.StepTime() * g_settings().AutoParams.EcoRate;
 
     if (g_gearStates.ThrottleHang < 0.0f)
         g_gearStates.ThrottleHang = 0.0f;
@@ -1349,7 +1310,7 @@ void functionClutchCatch() {
 }
 
 void functionEngStall() {
-    const float stallRate = MISC::GET_FRAME_TIME() * g_settings().MTParams.StallingRate;
+    const float stallRate = g_gearboxStep.StepSize() * g_settings().MTParams.StallingRate;
     const float stallSlip = g_settings().MTParams.StallingSlip;
 
     float minSpeed = g_settings().MTParams.StallingRPM * abs(g_vehData.mDriveMaxFlatVel / g_vehData.mGearRatios[g_vehData.mGearCurr]);
@@ -1363,22 +1324,27 @@ void functionEngStall() {
 
     float clutchRatio = map(g_controls.ClutchVal, 1.0f - g_settings().MTParams.ClutchThreshold, 0.0f, 0.0f, 1.0f);
 
-    if (clutchEngaged &&
+    bool stalling = clutchEngaged &&
         g_vehData.mRPM <= 0.201f && //engine actually has to idle
         abs(actualSpeed) < abs(minSpeed) &&
-        VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
-        float finalClutchRatio = map(clutchRatio, stallSlip, 1.0f, 0.0f, 1.0f);
-        float change = finalClutchRatio * speedDiffRatio * stallRate;
-        g_gearStates.StallProgress += change;
-    }
-    else if (g_gearStates.StallProgress > 0.0f) {
-        float change = stallRate; // "subtract" quickly
-        g_gearStates.StallProgress -= change;
+        EntityCache::GetEngineRunning(g_playerVehicle);
+
+    // Stop at the step that stalls, so the stall lands at the same point at any frame rate.
+    for (uint32_t step = 0; step < g_gearboxStep.Steps() && g_gearStates.StallProgress <= 1.0f; ++step) {
+        if (stalling) {
+            float finalClutchRatio = map(clutchRatio, stallSlip, 1.0f, 0.0f, 1.0f);
+            float change = finalClutchRatio * speedDiffRatio * stallRate;
+            g_gearStates.StallProgress += change;
+        }
+        else if (g_gearStates.StallProgress > 0.0f) {
+            float change = stallRate; // "subtract" quickly
+            g_gearStates.StallProgress -= change;
+        }
     }
 
     if (g_gearStates.StallProgress > 1.0f) {
-        if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
-            VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, false, true, true);
+        if (EntityCache::GetEngineRunning(g_playerVehicle)) {
+            EntityCache::SetEngineOn(g_playerVehicle, false, true, true);
             g_peripherals.IgnitionState = IgnitionState::Stall;
 
             if (g_controls.PrevInput == CarControls::Wheel)
@@ -1394,9 +1360,9 @@ void functionEngStall() {
 
     // Simulate push-start
     // We'll just assume the ignition thing is in the "on" position.
-    if (actualSpeed > minSpeed && !VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) &&
+    if (actualSpeed > minSpeed && !EntityCache::GetEngineRunning(g_playerVehicle) &&
         clutchEngaged) {
-        VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, true, true, true);
+        EntityCache::SetEngineOn(g_playerVehicle, true, true, true);
     }
 
     //UI::ShowText(0.1, 0.00, 0.4, fmt::format("Stall progress: {:.2f}", g_gearStates.StallProgress));
@@ -1431,7 +1397,7 @@ void functionEngLock() {
     }
     const float reverseThreshold = 2.0f;
 
-    float dashms = abs(ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y);
+    float dashms = abs(EntityCache::GetSpeedVector(g_playerVehicle).y);
 
     float speed = dashms;
     auto ratios = g_vehData.mGearRatios;
@@ -1442,7 +1408,7 @@ void functionEngLock() {
     auto wheelsSpeed = g_vehData.mWheelAverageDrivenTyreSpeed;
 
     bool wrongDirection = false;
-    if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle)) {
+    if (EntityCache::GetEngineRunning(g_playerVehicle)) {
         if (g_vehData.mGearCurr == 0) {
             if (g_vehData.mVelocity.y > reverseThreshold && wheelsSpeed > reverseThreshold) {
                 wrongDirection = true;
@@ -1488,7 +1454,7 @@ void functionEngLock() {
                     oldEngineHealth - damageToApply);
             }
             else {
-                VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, false, true, true);
+                EntityCache::SetEngineOn(g_playerVehicle, false, true, true);
             }
         }
         if (g_settings.Debug.DisplayInfo) {
@@ -1517,7 +1483,7 @@ void functionEngBrake() {
     if (g_wheelPatchStates.EngLockActive || 
         g_wheelPatchStates.InduceBurnout || 
         g_gearStates.FakeNeutral ||
-        ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < 5.0f ||
+        EntityCache::GetSpeedVector(g_playerVehicle).y < 5.0f ||
         g_vehData.mRPM < activeBrakeThreshold || 
         inputMultiplier < 0.05f) {
         g_wheelPatchStates.EngBrakeActive = false;
@@ -1545,20 +1511,17 @@ void functionEngBrake() {
 ///////////////////////////////////////////////////////////////////////////////
 
 void handleBrakePatch() {
-    auto absData = DrivingAssists::GetABS();
-    auto tcsData = DrivingAssists::GetTCS();
-    auto espData = DrivingAssists::GetESP();
-    auto lsdData = DrivingAssists::GetLSD();
+    auto wheels = DrivingAssists::GetWheelBlock();
+    auto assists = DrivingAssists::Evaluate(wheels);
+    auto& absData = assists.ABS;
+    auto& tcsData = assists.TCS;
+    auto& espData = assists.ESP;
+    auto& lsdData = assists.LSD;
 
     if (tcsData.Use && g_settings().DriveAssists.TCS.Mode == 1) {
         PAD::DISABLE_CONTROL_ACTION(2, eControl::ControlVehicleAccelerate, true);
-        for (int i = 0; i < g_vehData.mWheelCount; i++) {
-            if (tcsData.SlippingWheels[i]) {
-                g_vehData.mWheelsTcs[i] = true;
-            }
-            else {
-                g_vehData.mWheelsTcs[i] = false;
-            }
+        for (int i = 0; i < wheels.Count; i++) {
+            g_vehData.mWheelsTcs[i] = tcsData.SlippingWheels[i];
         }
     }
 
@@ -1587,63 +1550,38 @@ void handleBrakePatch() {
     if (g_wheelPatchStates.InduceBurnout) {
         patchThrottle = true;
         patchBrake = true;
-        if (!MemoryPatcher::BrakePatcher.Patched()) {
-            MemoryPatcher::PatchBrake();
-        }
-        if (!MemoryPatcher::ThrottlePatcher.Patched()) {
-            MemoryPatcher::PatchThrottle();
-        }
+    }
+
+    // Applied before this tick's wheel writes. When restored, the writes
+    // below still zero what the patched code left behind.
+    bool throttleWasPatched = MemoryPatcher::ThrottlePatcher.Patched();
+    bool brakeWasPatched = MemoryPatcher::BrakePatcher.Patched();
+    MemoryPatcher::SetWanted(MemoryPatcher::EPatch::Throttle, patchThrottle);
+    MemoryPatcher::SetWanted(MemoryPatcher::EPatch::Brake, patchBrake);
+    MemoryPatcher::ReconcilePatch(MemoryPatcher::EPatch::Throttle);
+    MemoryPatcher::ReconcilePatch(MemoryPatcher::EPatch::Brake);
+
+    if (g_wheelPatchStates.InduceBurnout) {
         if (g_settings.Debug.DisplayInfo)
             UI::ShowText(0.45, 0.75, 1.0, "~r~Burnout");
     }
     else {
-        if (patchThrottle) {
-            if (!MemoryPatcher::ThrottlePatcher.Patched()) {
-                MemoryPatcher::PatchThrottle();
-            }
-        }
-
         if (patchBrake) {
-            if (!MemoryPatcher::BrakePatcher.Patched()) {
-                MemoryPatcher::PatchBrake();
-            }
-        }
-
-        // LSD is used in all assists, but this case if for when no other
-        // assists are active.
-        if (lsdData.Use) {
-            auto brakeVals = DrivingAssists::GetLSDBrakes(lsdData);
-            for (int i = 0; i < g_vehData.mWheelCount; i++) {
-                VExt::SetWheelBrakePressure(g_playerVehicle, i, brakeVals[i]);
-            }
-        }
-        if (espData.Use) {
-            auto brakeVals = DrivingAssists::GetESPBrakes(espData, lsdData);
-            for (int i = 0; i < g_vehData.mWheelCount; i++) {
-                VExt::SetWheelBrakePressure(g_playerVehicle, i, brakeVals[i]);
-            }
-        }
-        if (tcsData.Use && g_settings().DriveAssists.TCS.Mode == 0) {
-            auto brakeVals = DrivingAssists::GetTCSBrakes(tcsData, lsdData);
-            for (int i = 0; i < g_vehData.mWheelCount; i++) {
-                VExt::SetWheelBrakePressure(g_playerVehicle, i, brakeVals[i]);
-            }
-        }
-        if (absData.Use) {
-            auto brakeVals = DrivingAssists::GetABSBrakes(absData, lsdData);
-            for (int i = 0; i < g_vehData.mWheelCount; i++) {
+            // LSD is used in all assists, but is also applied on its own
+            // when no other assists are active.
+            auto brakeVals = DrivingAssists::GetBrakes(assists, wheels);
+            for (int i = 0; i < wheels.Count; i++) {
                 VExt::SetWheelBrakePressure(g_playerVehicle, i, brakeVals[i]);
             }
         }
     }
     if (!patchBrake) {
-        if (MemoryPatcher::BrakePatcher.Patched()) {
+        if (brakeWasPatched) {
             for (int i = 0; i < g_vehData.mWheelCount; i++) {
                 if (g_controls.BrakeVal == 0.0f) {
                     VExt::SetWheelBrakePressure(g_playerVehicle, i, 0.0f);
                 }
             }
-            MemoryPatcher::RestoreBrake();
         }
         for (int i = 0; i < g_vehData.mWheelCount; i++) {
             g_vehData.mWheelsAbs[i] = false;
@@ -1652,13 +1590,12 @@ void handleBrakePatch() {
         }
     }
     if (!patchThrottle) {
-        if (MemoryPatcher::ThrottlePatcher.Patched()) {
+        if (throttleWasPatched) {
             for (int i = 0; i < g_vehData.mWheelCount; i++) {
                 if (g_controls.ThrottleVal == 0.0f) {
                     VExt::SetWheelPower(g_playerVehicle, i, 0.0f);
                 }
             }
-            MemoryPatcher::RestoreThrottle();
         }
         for (int i = 0; i < g_vehData.mWheelCount; i++) {
             if (!tcsData.Use)
@@ -1727,7 +1664,7 @@ void handleRPM() {
     // Update 2017-08-12: We know the gear speeds now, consider patching
     // shiftUp completely?
     if (g_vehData.mGearCurr > 0 &&
-        (g_gearStates.HitRPMSpeedLimiter && ENTITY::GET_ENTITY_SPEED(g_playerVehicle) > 2.0f)) {
+        (g_gearStates.HitRPMSpeedLimiter && EntityCache::GetSpeed(g_playerVehicle) > 2.0f)) {
         PAD::DISABLE_CONTROL_ACTION(0, ControlVehicleAccelerate, true);
         VExt::SetThrottle(g_playerVehicle, 0.0f);
         VExt::SetThrottleP(g_playerVehicle, 0.0f);
@@ -1767,7 +1704,7 @@ void handleRPM() {
     }
 
     if (g_gearStates.FakeNeutral || clutch >= 1.0f) {
-        if (ENTITY::GET_ENTITY_SPEED(g_playerVehicle) < 1.0f) {
+        if (EntityCache::GetSpeed(g_playerVehicle) < 1.0f) {
             finalClutch = -5.0f;
         }
         else {
@@ -1777,16 +1714,19 @@ void handleRPM() {
 
     // >= 1.0 RPM custom rev limit: oscillates RPM, and off-throttle triggers exhaust pops
     if (g_gearStates.FakeNeutral || clutch >= 1.0f || VExt::GetHandbrake(g_playerVehicle)) {
-        if (VExt::GetCurrentRPM(g_playerVehicle) >= 1.0f && g_gearStates.LastRedline == 0) {
-            g_gearStates.LastRedline = MISC::GET_GAME_TIMER();
+        if (g_gearStates.RedlineTime >= 0.0f) {
+            g_gearStates.RedlineTime += g_gearboxStep.StepTime();
+        }
+        else if (VExt::GetCurrentRPM(g_playerVehicle) >= 1.0f) {
+            g_gearStates.RedlineTime = 0.0f;
         }
 
-        if (g_gearStates.LastRedline > 0 && MISC::GET_GAME_TIMER() >= g_gearStates.LastRedline + 25 &&
+        if (g_gearStates.RedlineTime >= 0.025f &&
             VExt::GetCurrentRPM(g_playerVehicle) >= 1.0f && VExt::GetThrottleP(g_playerVehicle) > 0.0f) {
             VExt::SetCurrentRPM(g_playerVehicle, 0.975f);
             VExt::SetThrottle(g_playerVehicle, 0.0f);
             VExt::SetThrottleP(g_playerVehicle, 0.0f);
-            g_gearStates.LastRedline = 0;
+            g_gearStates.RedlineTime = -1.0f;
         }
     }
 
@@ -1812,7 +1752,7 @@ void functionLimiter() {
     float DriveMaxFlatVel = g_vehData.mDriveMaxFlatVel;
     float maxSpeed = DriveMaxFlatVel / ratios[g_vehData.mGearCurr];
 
-    if (ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y > maxSpeed && g_vehData.mRPM >= 1.0f) {
+    if (EntityCache::GetSpeedVector(g_playerVehicle).y > maxSpeed && g_vehData.mRPM >= 1.0f) {
         g_gearStates.HitRPMSpeedLimiter = true;
     }
     else {
@@ -1830,7 +1770,7 @@ void functionRealReverse() {
     if (g_vehData.mGearCurr > 0) {
         // LT behavior when stopped: Just brake
         if (g_controls.BrakeVal > 0.01f && g_controls.ThrottleVal < g_controls.BrakeVal &&
-            ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < 0.5f && ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y >= -0.5f) { // < 0.5 so reverse never triggers
+            EntityCache::GetSpeedVector(g_playerVehicle).y < 0.5f && EntityCache::GetSpeedVector(g_playerVehicle).y >= -0.5f) { // < 0.5 so reverse never triggers
                                                                     //UI::ShowText(0.3, 0.3, 0.5, "functionRealReverse: Brake @ Stop");
             PAD::DISABLE_CONTROL_ACTION(0, ControlVehicleBrake, true);
             VExt::SetThrottleP(g_playerVehicle, 0.1f);
@@ -1839,7 +1779,7 @@ void functionRealReverse() {
         }
         // LT behavior when rolling back: Brake
         if (g_controls.BrakeVal > 0.01f && g_controls.ThrottleVal < g_controls.BrakeVal &&
-            ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < -0.5f) {
+            EntityCache::GetSpeedVector(g_playerVehicle).y < -0.5f) {
             //UI::ShowText(0.3, 0.3, 0.5, "functionRealReverse: Brake @ Rollback");
             VEHICLE::SET_VEHICLE_BRAKE_LIGHTS(g_playerVehicle, true);
             PAD::DISABLE_CONTROL_ACTION(0, ControlVehicleBrake, true);
@@ -1850,7 +1790,7 @@ void functionRealReverse() {
         }
         // RT behavior when rolling back: Burnout
         if (!g_gearStates.FakeNeutral && g_controls.ThrottleVal > 0.5f && !isClutchPressed() &&
-            ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < -1.0f ) {
+            EntityCache::GetSpeedVector(g_playerVehicle).y < -1.0f ) {
             //UI::ShowText(0.3, 0.3, 0.5, "functionRealReverse: Throttle @ Rollback");
             //PAD::_SET_CONTROL_NORMAL(0, ControlVehicleBrake, carControls.ThrottleVal);
             if (g_controls.BrakeVal < 0.1f) {
@@ -1893,7 +1833,7 @@ void functionRealReverse() {
         }
         // LT behavior when reversing
         if (g_controls.BrakeVal > 0.01f &&
-            ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y <= -0.5f) {
+            EntityCache::GetSpeedVector(g_playerVehicle).y <= -0.5f) {
             throttleAndSomeBrake++;
             //UI::ShowText(0.3, 0.35, 0.5, "functionRealReverse: Brake @ Reverse");
 
@@ -1911,7 +1851,7 @@ void functionRealReverse() {
 
         // LT behavior when forward
         if (g_controls.BrakeVal > 0.01f && g_controls.ThrottleVal <= g_controls.BrakeVal &&
-            ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y > 0.1f) {
+            EntityCache::GetSpeedVector(g_playerVehicle).y > 0.1f) {
             //UI::ShowText(0.3, 0.3, 0.5, "functionRealReverse: Brake @ Rollforwrd");
 
             VEHICLE::SET_VEHICLE_BRAKE_LIGHTS(g_playerVehicle, true);
@@ -1923,7 +1863,7 @@ void functionRealReverse() {
 
         // LT behavior when still
         if (g_controls.BrakeVal > 0.01f && g_controls.ThrottleVal <= g_controls.BrakeVal &&
-            ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y > -0.5f && ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y <= 0.1f) {
+            EntityCache::GetSpeedVector(g_playerVehicle).y > -0.5f && EntityCache::GetSpeedVector(g_playerVehicle).y <= 0.1f) {
             //UI::ShowText(0.3, 0.3, 0.5, "functionRealReverse: Brake @ Stopped");
 
             VEHICLE::SET_VEHICLE_BRAKE_LIGHTS(g_playerVehicle, true);
@@ -1937,7 +1877,7 @@ void functionAutoReverse() {
     // Go forward
     if (PAD::IS_CONTROL_PRESSED(0, ControlVehicleAccelerate) && 
         !PAD::IS_CONTROL_PRESSED(0, ControlVehicleBrake) &&
-        ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y > -1.0f &&
+        EntityCache::GetSpeedVector(g_playerVehicle).y > -1.0f &&
         g_vehData.mGearCurr == 0) {
         shiftTo(1, false);
     }
@@ -1945,7 +1885,7 @@ void functionAutoReverse() {
     // Reverse
     if (PAD::IS_CONTROL_PRESSED(0, ControlVehicleBrake) && 
         !PAD::IS_CONTROL_PRESSED(0, ControlVehicleAccelerate) &&
-        ENTITY::GET_ENTITY_SPEED_VECTOR(g_playerVehicle, true).y < 1.0f &&
+        EntityCache::GetSpeedVector(g_playerVehicle).y < 1.0f &&
         g_vehData.mGearCurr > 0) {
         g_gearStates.FakeNeutral = false;
         shiftTo(0, false);
@@ -2018,14 +1958,14 @@ void startStopEngine() {
         throttleStart = g_controls.ThrottleVal > 0.75f && freeGear;
     }
 
-    if (!VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) &&
+    if (!EntityCache::GetEngineRunning(g_playerVehicle) &&
         (controllerActive || keyboardActive || wheelActive || throttleStart)) {
-        VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, true, false, true);
+        EntityCache::SetEngineOn(g_playerVehicle, true, false, true);
     }
 
-    if (VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) &&
+    if (EntityCache::GetEngineRunning(g_playerVehicle) &&
         (controllerActive && g_settings.Controller.ToggleEngine || keyboardActive || wheelActive)) {
-        VEHICLE::SET_VEHICLE_ENGINE_ON(g_playerVehicle, false, true, true);
+        EntityCache::SetEngineOn(g_playerVehicle, false, true, true);
         StartingAnimation::PlayManual();
     }
 }
@@ -2043,7 +1983,7 @@ void functionAutoLookback() {
 }
 
 void functionAutoGear1() {
-    if (g_vehData.mThrottle < 0.1f && ENTITY::GET_ENTITY_SPEED(g_playerVehicle) < 0.1f && g_vehData.mGearCurr > 1) {
+    if (g_vehData.mThrottle < 0.1f && EntityCache::GetSpeed(g_playerVehicle) < 0.1f && g_vehData.mGearCurr > 1) {
         shiftTo(1, false);
     }
 }
@@ -2052,7 +1992,7 @@ void functionHillGravity() {
     // TODO: Needs improvement/proper fix
     if (g_controls.HandbrakeVal < 0.1f && 
         g_controls.BrakeVal < 0.1f &&
-        ENTITY::GET_ENTITY_SPEED(g_playerVehicle) < 2.0f &&
+        EntityCache::GetSpeed(g_playerVehicle) < 2.0f &&
         VEHICLE::IS_VEHICLE_ON_ALL_WHEELS(g_playerVehicle)) {
         float pitch = ENTITY::GET_ENTITY_PITCH(g_playerVehicle);;
 
@@ -2145,7 +2085,7 @@ void functionAudioFX() {
             // Stop when engine is off
             // Stop when clutch is pressed
             if (isHShifterJustNeutral() ||
-                !VEHICLE::GET_IS_VEHICLE_ENGINE_RUNNING(g_playerVehicle) || 
+                !EntityCache::GetEngineRunning(g_playerVehicle) || 
                 isClutchPressed()) {
                 g_gearRattle1.Stop();
                 g_gearRattle2.Stop();
@@ -2176,38 +2116,37 @@ void update_UDPTelemetry() {
 ///////////////////////////////////////////////////////////////////////////////
 
 void loadConfigs() {
-    logger.Write(DEBUG, "Clearing and reloading vehicle configs...");
-    g_vehConfigs.clear();
+    logger.Write(DEBUG, "Reloading vehicle configs...");
+
+    // The active config points into g_vehConfigs, which is replaced below.
+    std::string oldName;
+    if (g_settings.ConfigActive()) {
+        oldName = g_settings().Name;
+    }
+    g_settings.SetVehicleConfig(nullptr);
+
+    ++g_vehConfigsGeneration;
+    g_vehConfigIndex.Clear();
     const std::string absoluteModPath = Paths::GetModuleFolder(Paths::GetOurModuleHandle()) + Constants::ModDir;
     const std::string vehConfigsPath = absoluteModPath + "\\Vehicles";
 
     if (!(fs::exists(fs::path(vehConfigsPath)) && fs::is_directory(fs::path(vehConfigsPath)))) {
         logger.Write(WARN, "Directory [%s] not found!", vehConfigsPath.c_str());
-        setVehicleConfig(g_playerVehicle);
+        g_vehConfigs.clear();
+        VehicleConfigLoader::Invalidate();
+        setVehicleConfig(g_playerVehicle, oldName);
         return;
     }
 
-    for (auto& file : fs::directory_iterator(vehConfigsPath)) {
-        if (StrUtil::toLower(fs::path(file).extension().string()) != ".ini")
-            continue;
-
-        if (StrUtil::toLower(fs::path(file).stem().string()) == "basevehicleconfig")
-            continue;
-
-        VehicleConfig config;
-        config.SetFiles(g_settings.BaseConfig(), file.path().string());
-        config.LoadSettings();
-        if (config.ModelNames.empty() && config.Plates.empty()) {
-            logger.Write(WARN,
-                "Vehicle settings file [%s] contained no model names or plates, skipping...",
-                file.path().string().c_str());
-            continue;
-        }
-        g_vehConfigs.push_back(config);
-        logger.Write(DEBUG, "Loaded vehicle config [%s]", config.Name.c_str());
-    }
+    const std::string cacheFile = g_settings.Debug.CacheVehicleConfigs ?
+        absoluteModPath + "\\vehicle_configs.cache" : std::string();
+    auto stats = VehicleConfigLoader::Load(vehConfigsPath, g_settings.BaseConfig(), g_vehConfigs, cacheFile);
+    logger.Write(DEBUG, "Vehicle configs parsed: %zu, reused: %zu, skipped: %zu%s",
+        stats.Parsed, stats.Reused, stats.Skipped, stats.FromCache ? " (cached)" : "");
+    g_vehConfigIndex.Build(g_vehConfigs);
     logger.Write(INFO, "Configs loaded: %d", g_vehConfigs.size());
-    setVehicleConfig(g_playerVehicle);
+    setVehicleConfig(g_playerVehicle, oldName);
+    g_vehConfigsWatcher.Sync();
 }
 
 // Always call *after* settings have been (re)loaded
@@ -2233,10 +2172,71 @@ void readSettings() {
     initTimers();
 
     SteeringAnimation::Load();
+    g_settingsWatcher.Sync();
 
     logger.Write(INFO, "Settings read");
 }
 
+void syncFileWatchers() {
+    g_settingsWatcher.Sync();
+    g_vehConfigsWatcher.Sync();
+}
+
+void startFileWatchers(const std::string& modPath) {
+    g_settingsWatcher.Start(modPath,
+        { "settings_general.ini", "settings_controls.ini", "settings_wheel.ini", "animations.yml" });
+
+    const std::string vehConfigsPath = modPath + "\\Vehicles";
+    if (fs::is_directory(fs::path(vehConfigsPath)))
+        g_vehConfigsWatcher.Start(vehConfigsPath, {});
+}
+
+// Applies edits made outside the game, only reading what changed.
+// Runs between ticks, so the update loop never sees half-read settings.
+void update_file_watchers() {
+    // The menu saves and reloads its own changes when it closes.
+    if (g_menu.IsThisOpen())
+        return;
+
+    bool reloadConfigs = false;
+    for (const auto& file : g_settingsWatcher.Update()) {
+        auto name = StrUtil::toLower(fs::path(file).filename().string());
+        if (name == "settings_general.ini") {
+            g_settings.ReadGeneral();
+            if (g_settings.Debug.LogLevel > 4)
+                g_settings.Debug.LogLevel = 1;
+            logger.SetMinLevel(static_cast<LogLevel>(g_settings.Debug.LogLevel));
+            initTimers();
+            // Vehicle configs inherit from the base config in this file.
+            reloadConfigs = true;
+        }
+        else if (name == "settings_controls.ini") {
+            g_settings.ReadControls(&g_controls);
+        }
+        else if (name == "settings_wheel.ini") {
+            g_settings.ReadWheel(&g_controls);
+            g_controls.CheckGUIDs(g_settings.Wheel.InputDevices.RegisteredGUIDs);
+        }
+        else if (name == "animations.yml") {
+            SteeringAnimation::Load();
+            if (g_playerVehicle)
+                updateActiveSteeringAnim(g_playerVehicle);
+        }
+        else {
+            continue;
+        }
+        logger.Write(INFO, "[Settings] Reloaded changed file [%s]", name.c_str());
+    }
+
+    for (const auto& file : g_vehConfigsWatcher.Update()) {
+        if (StrUtil::toLower(fs::path(file).extension().string()) == ".ini")
+            reloadConfigs = true;
+    }
+
+    if (reloadConfigs)
+        loadConfigs();
+}
+
 void threadCheckUpdate(unsigned milliseconds) {
     std::thread([milliseconds]() {
         std::lock_guard releaseInfoLock(g_releaseInfoMutex);
@@ -2302,6 +2302,7 @@ void main() {
 
     readSettings();
     loadConfigs();
+    startFileWatchers(absoluteModPath);
 
     if (g_settings.Update.EnableUpdate) {
         threadCheckUpdate(10000);
@@ -2366,21 +2367,29 @@ void main() {
     StartUDPTelemetry();
 
     while (true) {
-        update_player();
-        update_vehicle();
-        Misc::UpdateEngineOnOff();
-        update_inputs();
-        update_steering();
-        update_hud();
-        update_input_controls();
-        update_manual_transmission();
-        update_misc_features();
-        update_menu();
-        update_update_notification();
-        update_UDPTelemetry();
-        SteeringAnimation::Update();
-        StartingAnimation::Update();
-        FPVCam::Update();
+        NativeProfiler::SetEnabled(g_settings.Debug.DisplayNativeCalls);
+        NativeProfiler::NewFrame();
+        EntityCache::NewFrame();
+        g_gearboxStep.Advance(MISC::GET_FRAME_TIME());
+        { NativeProfiler::Scope _("Player");       update_player(); }
+        { NativeProfiler::Scope _("Vehicle");      update_vehicle(); }
+        { NativeProfiler::Scope _("EngineOnOff");  Misc::UpdateEngineOnOff(); }
+        { NativeProfiler::Scope _("Inputs");       update_inputs(); }
+        { NativeProfiler::Scope _("Steering");     update_steering(); }
+        { NativeProfiler::Scope _("HUD");          update_hud(); }
+        { NativeProfiler::Scope _("InputCtrl");    update_input_controls(); }
+        { NativeProfiler::Scope _("Gearbox");      update_manual_transmission(); }
+        { NativeProfiler::Scope _("Misc");         update_misc_features(); }
+        { NativeProfiler::Scope _("Menu");         update_menu(); }
+        { NativeProfiler::Scope _("Update");       update_update_notification(); }
+        { NativeProfiler::Scope _("Telemetry");    update_UDPTelemetry(); }
+        { NativeProfiler::Scope _("SteeringAnim"); SteeringAnimation::Update(); }
+        { NativeProfiler::Scope _("StartingAnim"); StartingAnimation::Update(); }
+        { NativeProfiler::Scope _("FPVCam");       FPVCam::Update(); }
+        { NativeProfiler::Scope _("FileWatch");    update_file_watchers(); }
+        { NativeProfiler::Scope _("Patches");      MemoryPatcher::ReconcilePatches(); }
+        publishMTState();
+        NativeProfiler::DrawOverlay();
         WAIT(0);
     }
 }
@@ -19,6 +19,9 @@ void resetSteeringMultiplier();
 void toggleManual(bool enable);
 void initWheel();
 
+// Publishes the state read by the MT_* API, once per tick.
+void publishMTState();
+
 ///////////////////////////////////////////////////////////////////////////////
 //                           Mod functions: Shifting
 ///////////////////////////////////////////////////////////////////////////////
@@ -43,6 +46,12 @@ void ScriptMain();
 void NPCMain();
 void initTimers();
 void saveAllSettings();
+void syncFileWatchers();
+
+// ScriptNPC
+struct MT_NPCGearboxState;
+bool isNPCVehicleIgnored(int vehicle);
+unsigned getNPCGearboxStates(MT_NPCGearboxState* states, unsigned capacity);
 
 ///////////////////////////////////////////////////////////////////////////////
 //                              Menu-related
@@ -3,6 +3,11 @@
 #include "main.h"
 #include <utility>
 
+#ifdef NATIVE_PROFILER
+// Defined in Gears/Util/NativeProfiler.cpp
+void NativeProfilerCount(UINT64 hash);
+#endif
+
 template <typename T>
 static inline void nativePush(T val)
 {
@@ -15,6 +20,9 @@ static inline void nativePush(T val)
 template <typename R>
 static inline R invoke(UINT64 hash)
 {
+#ifdef NATIVE_PROFILER
+    NativeProfilerCount(hash);
+#endif
     nativeInit(hash);
     return *reinterpret_cast<R *>(nativeCall());
 }
@@ -22,6 +30,9 @@ static inline R invoke(UINT64 hash)
 template <typename R, class ... Args>
 static inline R invoke(UINT64 hash, Args&& ... args)
 {
+#ifdef NATIVE_PROFILER
+    NativeProfilerCount(hash);
+#endif
     nativeInit(hash);
 
     (nativePush(std::forward<Args>(args)), ...);